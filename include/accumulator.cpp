@@ -0,0 +1,151 @@
+/**
+ *  @file		accumulator.cpp
+ *  @brief	  Implement the template code for the concurrent accumulator
+ *
+ * 	Details
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-19-2026
+ *  @version	0.1
+ */
+
+#include <algorithm>
+#include <vector>
+#include <stdexcept>
+
+#include "accumulator.h"
+
+namespace matrix {
+	//
+	// Constructor
+	//
+	template <int M, int N, typename T>
+	Accumulator<M, N, T>::Accumulator(int writers) :
+			slots(std::max(writers, 0)),
+			stripes(STRIPES) {
+		if(writers <= 0)
+			throw std::invalid_argument("an accumulator needs at least one writer");
+	}
+
+	//
+	// buffer (int) -> Matrix<M, N, T>&
+	//
+	template <int M, int N, typename T>
+	Matrix<M, N, T>& Accumulator<M, N, T>::buffer(int writer) {
+		if(writer < 0 || writer >= this->getWriters())
+			throw std::out_of_range("writer must be within the number of writers");
+
+		Slot& slot = this->slots[writer];
+		std::call_once(slot.allocated, [&slot] () {
+			slot.buffer = std::make_unique<Matrix<M, N, T>>();
+		});
+		return *slot.buffer;
+	}
+
+	//
+	// add (int, const Matrix<M, N, T>&) -> void
+	//
+	template <int M, int N, typename T>
+	void Accumulator<M, N, T>::add(int writer, const Matrix<M, N, T>& partial) {
+		this->buffer(writer) += partial;
+	}
+
+	//
+	// addAt (int, int, int, const T&) -> void
+	//
+	template <int M, int N, typename T>
+	void Accumulator<M, N, T>::addAt(int writer, int row, int column, const T& value) {
+		if(row < 0 || row >= M || column < 0 || column >= N)
+			throw std::out_of_range("(row, column) must be within the matrix");
+
+		this->buffer(writer)[row][column] += value;
+	}
+
+	//
+	// addAt (int, int, const T&) -> void
+	//
+	template <int M, int N, typename T>
+	void Accumulator<M, N, T>::addAt(int row, int column, const T& value) {
+		if(row < 0 || row >= M || column < 0 || column >= N)
+			throw std::out_of_range("(row, column) must be within the matrix");
+
+		std::call_once(this->sharedAllocated, [this] () {
+			this->shared = std::make_unique<Matrix<M, N, T>>();
+		});
+
+		std::lock_guard<std::mutex> lock(this->stripes[row % STRIPES].mutex);
+		(*this->shared)[row][column] += value;
+	}
+
+	//
+	// result () const -> Matrix<M, N, T>
+	//
+	template <int M, int N, typename T>
+	Matrix<M, N, T> Accumulator<M, N, T>::result() const {
+		Matrix<M, N, T> sum;
+
+		// Only writers that added something take part, still in writer order
+		std::vector<const Matrix<M, N, T>*> sources;
+		for(const Slot& slot : this->slots) {
+			if(slot.buffer)
+				sources.push_back(slot.buffer.get());
+		}
+		if(this->shared)
+			sources.push_back(this->shared.get());
+
+		const int count = static_cast<int>(sources.size());
+		if(count == 0)
+			return sum;
+
+		// Each row is reduced on its own, so a block of rows runs the whole tree
+		// without waiting on the other blocks
+		kernels::forRows(M, N * count, [&] (int begin, int end) {
+			std::vector<T> scratch(static_cast<std::size_t>(count / 2) * N);
+			std::vector<const T*> level(count);
+
+			for(int row = begin; row < end; ++row) {
+				for(int i = 0; i < count; ++i)
+					level[i] = (*sources[i])[row].data();
+
+				// Pair i of a level is written over scratch i, which the pairs
+				// before it have already read
+				for(int live = count; live > 1; live = (live + 1) / 2) {
+					for(int pair = 0; pair < live / 2; ++pair) {
+						const T* left = level[2 * pair];
+						const T* right = level[2 * pair + 1];
+						T* out = scratch.data() + static_cast<std::size_t>(pair) * N;
+						for(int column = 0; column < N; ++column)
+							out[column] = left[column] + right[column];
+						level[pair] = out;
+					}
+					if(live % 2 == 1)
+						level[live / 2] = level[live - 1];
+				}
+
+				std::copy(level[0], level[0] + N, sum[row].begin());
+			}
+		});
+
+		return sum;
+	}
+
+	//
+	// reset () -> void
+	//
+	template <int M, int N, typename T>
+	void Accumulator<M, N, T>::reset() {
+		auto zero = [] (Matrix<M, N, T>& m) {
+			kernels::forRows(M, N, [&m] (int begin, int end) {
+				for(int row = begin; row < end; ++row)
+					std::fill(m[row].begin(), m[row].end(), T());
+			});
+		};
+
+		for(Slot& slot : this->slots) {
+			if(slot.buffer)
+				zero(*slot.buffer);
+		}
+		if(this->shared)
+			zero(*this->shared);
+	}
+}
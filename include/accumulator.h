@@ -0,0 +1,131 @@
+/**
+ *  @file		accumulator.h
+ *  @brief	  Define a thread safe sum of partial matrices from many writers
+ *
+ * 	Each writer adds its partial results into a private buffer, so writers
+ * 	never share a cache line or a lock.  result() merges the buffers with a
+ * 	pairwise tree in writer order, split across the ThreadPool by rows, so
+ * 	the sum is the same however the writers were scheduled.
+ * 	Scattered single values can instead go straight to a shared matrix guarded
+ * 	by striped locks, at the cost of a scheduling dependent order.
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-19-2026
+ *  @version	0.1
+ */
+
+#ifndef ACCUMULATOR_H
+#define ACCUMULATOR_H
+
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <stdexcept>
+
+#include "matrix/matrix.h"
+
+namespace matrix {
+
+	/**
+	 * 	@class		Accumulator
+	 * 	@brief		Sum of M x N partial results from a fixed number of writers
+	 *
+	 * 	Writer i may only be used by one thread at a time, different writers
+	 * 	and addAt() without a writer may be used concurrently.  result() and
+	 * 	reset() must not run while anyone is writing.
+	 *
+	 */
+	template <int M, int N, typename T>
+	class Accumulator {
+		public:
+			/**
+			 * 	@brief	Constructor
+			 *
+			 * 	Buffers are allocated on first use, by the writer's own thread
+			 *
+			 * 	@param	int		Number of writers
+			 *
+			 * 	@version	0.1
+			 */
+			explicit Accumulator(int writers);
+
+			/**
+			 * 	@brief	Private buffer of a writer, to accumulate into in place
+			 *
+			 * 	@param	int						Index of the writer
+			 * 	@return	  Matrix<M, N, T>&		Sum of what the writer has added so far
+			 * 	@throws   std::out_of_range		If writer isn't in [0, getWriters())
+			 *
+			 * 	@version	0.1
+			 */
+			Matrix<M, N, T>& buffer(int writer);
+
+			/// Add a partial result into the writer's buffer
+			void add(int writer, const Matrix<M, N, T>& partial);
+
+			/// Add value at (row, column) of the writer's buffer
+			void addAt(int writer, int row, int column, const T& value);
+
+			/**
+			 * 	@brief	Add value at (row, column) of the shared matrix, from any thread
+			 *
+			 * 	Rows are guarded by one of STRIPES locks, so writers touching
+			 * 	different rows rarely wait.  Concurrent floating point additions
+			 * 	to the same value land in arrival order, so use a writer's buffer
+			 * 	when the result must be reproducible.
+			 *
+			 * 	@throws   std::out_of_range		If (row, column) is outside the matrix
+			 *
+			 * 	@version	0.1
+			 */
+			void addAt(int row, int column, const T& value);
+
+			/**
+			 * 	@brief	Merge every buffer, then the shared matrix
+			 *
+			 * 	Buffers are summed pairwise in writer order, (0 + 1) + (2 + 3) and
+			 * 	so on, skipping writers that never added anything
+			 *
+			 * 	@return	  Matrix<M, N, T>		Sum of everything added
+			 *
+			 * 	@version	0.1
+			 */
+			Matrix<M, N, T> result() const;
+
+			/// Zero every buffer and the shared matrix, keeping them allocated
+			void reset();
+
+			// ----- Inline Methods -----
+			/// Get the number of writers
+			inline int getWriters() const { return static_cast<int>(this->slots.size()); }
+
+			/// Number of locks guarding the rows of the shared matrix
+			static constexpr int STRIPES = 64;
+
+		private:
+			/// Buffer of one writer, on its own cache line
+			struct alignas(64) Slot {
+				std::once_flag allocated;
+				std::unique_ptr<Matrix<M, N, T>> buffer;
+			};
+
+			/// Lock on its own cache line
+			struct alignas(64) Stripe {
+				std::mutex mutex;
+			};
+
+			/// Buffers indexed by writer
+			std::vector<Slot> slots;
+
+			/// Matrix addAt() without a writer adds into, allocated on first use
+			std::once_flag sharedAllocated;
+			std::unique_ptr<Matrix<M, N, T>> shared;
+
+			/// Locks guarding the rows of shared
+			std::vector<Stripe> stripes;
+	};
+}
+
+#include "matrix/accumulator.cpp"
+
+#endif
@@ -0,0 +1,261 @@
+/**
+ *  @file		async.cpp
+ *  @brief	  Implement the template code for the asynchronous matrix operations
+ *
+ * 	Details
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-19-2026
+ *  @version	0.1
+ */
+
+#include "async.h"
+
+namespace matrix {
+	//
+	// Constructor
+	//
+	template <typename T>
+	Task<T>::Task(CancellationToken token) :
+			state(std::make_shared<State>()) {
+		this->state->token = std::move(token);
+	}
+
+	//
+	// get () -> const T&
+	//
+	template <typename T>
+	const T& Task<T>::get() const {
+		this->wait();
+
+		if(this->state->error)
+			std::rethrow_exception(this->state->error);
+		return *(this->state->value);
+	}
+
+	//
+	// wait () -> void
+	//
+	template <typename T>
+	void Task<T>::wait() const {
+		std::unique_lock<std::mutex> lock(this->state->mutex);
+		this->state->completed.wait(lock, [this] () { return this->state->finished; });
+	}
+
+	//
+	// isReady () -> bool
+	//
+	template <typename T>
+	bool Task<T>::isReady() const {
+		std::lock_guard<std::mutex> lock(this->state->mutex);
+		return this->state->finished;
+	}
+
+	//
+	// then (Function) -> Task<std::invoke_result_t<Function, const T&>>
+	//
+	template <typename T>
+	template <typename Function>
+	auto Task<T>::then(Function function) const -> Task<std::invoke_result_t<Function, const T&>> {
+		Task<std::invoke_result_t<Function, const T&>> next(this->state->token.child());
+		Task<T> previous = *this;
+
+		this->onComplete([previous, next, function] () mutable {
+			try {
+				if(next.getToken().isCancelled())
+					throw OperationCancelled();
+				next.setValue(function(previous.get()));
+			}
+			catch(...) {
+				next.setException(std::current_exception());
+			}
+		});
+
+		return next;
+	}
+
+	//
+	// setValue (T) -> void
+	//
+	template <typename T>
+	void Task<T>::setValue(T value) const {
+		std::unique_lock<std::mutex> lock(this->state->mutex);
+		this->state->value.emplace(std::move(value));
+		this->finish(lock);
+	}
+
+	//
+	// setException (std::exception_ptr) -> void
+	//
+	template <typename T>
+	void Task<T>::setException(std::exception_ptr error) const {
+		std::unique_lock<std::mutex> lock(this->state->mutex);
+		this->state->error = error;
+		this->finish(lock);
+	}
+
+	//
+	// onComplete (std::function<void()>) -> void
+	//
+	template <typename T>
+	void Task<T>::onComplete(std::function<void()> callback) const {
+		{
+			std::lock_guard<std::mutex> lock(this->state->mutex);
+			if(!this->state->finished) {
+				this->state->continuations.push_back(std::move(callback));
+				return;
+			}
+		}
+		ThreadPool::getInstance().post(std::move(callback));
+	}
+
+	//
+	// finish (std::unique_lock<std::mutex>&) -> void
+	//
+	template <typename T>
+	void Task<T>::finish(std::unique_lock<std::mutex>& lock) const {
+		this->state->finished = true;
+		std::vector<std::function<void()>> continuations = std::move(this->state->continuations);
+		lock.unlock();
+
+		this->state->completed.notify_all();
+		for(auto& continuation : continuations)
+			ThreadPool::getInstance().post(std::move(continuation));
+	}
+
+	//
+	// runAsync (Function, CancellationToken) -> Task<std::invoke_result_t<Function>>
+	//
+	template <typename Function>
+	auto runAsync(Function function, CancellationToken token)
+			-> Task<std::invoke_result_t<Function>> {
+		Task<std::invoke_result_t<Function>> task(std::move(token));
+
+		ThreadPool::getInstance().post([task, function] () mutable {
+			try {
+				if(task.getToken().isCancelled())
+					throw OperationCancelled();
+				task.setValue(function());
+			}
+			catch(...) {
+				task.setException(std::current_exception());
+			}
+		});
+
+		return task;
+	}
+
+	//
+	// join (const Task<A>&, const Task<B>&, Function) -> Task<...>
+	//
+	template <typename A, typename B, typename Function>
+	auto join(const Task<A>& lhs, const Task<B>& rhs, Function function)
+			-> Task<std::invoke_result_t<Function, const A&, const B&>> {
+		using Result = std::invoke_result_t<Function, const A&, const B&>;
+		Task<Result> joined(lhs.getToken().child());
+		joinInto(lhs, rhs, joined, std::move(function));
+
+		return joined;
+	}
+
+	//
+	// joinInto (const Task<A>&, const Task<B>&, const Task<Result>&, Function) -> void
+	//
+	template <typename A, typename B, typename Result, typename Function>
+	void joinInto(const Task<A>& lhs, const Task<B>& rhs, const Task<Result>& joined, Function function) {
+		// Whichever dependency finishes last runs the function
+		auto remaining = std::make_shared<std::atomic<int>>(2);
+		auto run = [lhs, rhs, joined, function, remaining] () mutable {
+			if(remaining->fetch_sub(1) != 1)
+				return;
+
+			try {
+				if(joined.getToken().isCancelled() || rhs.getToken().isCancelled())
+					throw OperationCancelled();
+				joined.setValue(function(lhs.get(), rhs.get()));
+			}
+			catch(...) {
+				joined.setException(std::current_exception());
+			}
+		};
+		lhs.onComplete(run);
+		rhs.onComplete(run);
+	}
+
+	//
+	// multiply (const Matrix<M, N, T>&, const Matrix<N, R, T>&, const CancellationToken&) -> Matrix<M, R, T>
+	//
+	template <int M, int N, int R, typename T>
+	Matrix<M, R, T> multiply(const Matrix<M, N, T>& lhs, const Matrix<N, R, T>& rhs,
+			const CancellationToken& token) {
+		Matrix<M, R, T> result;
+
+		std::vector<const T*> leftRows(M), rightRows(N);
+		std::vector<T*> resultRows(M);
+		for(int row = 0; row < M; ++row) {
+			leftRows[row] = lhs[row].data();
+			resultRows[row] = result[row].data();
+		}
+		for(int row = 0; row < N; ++row)
+			rightRows[row] = rhs[row].data();
+
+		if(!kernels::parallelGemm(leftRows.data(), rightRows.data(), resultRows.data(), M, N, R,
+				[&token] () { return token.isCancelled(); }))
+			throw OperationCancelled();
+
+		return result;
+	}
+
+	//
+	// multiplyAsync (Matrix<M, N, T>, Matrix<N, R, T>, CancellationToken) -> Task<Matrix<M, R, T>>
+	//
+	template <int M, int N, int R, typename T>
+	Task<Matrix<M, R, T>> multiplyAsync(Matrix<M, N, T> lhs, Matrix<N, R, T> rhs,
+			CancellationToken token) {
+		auto operands = std::make_shared<std::pair<Matrix<M, N, T>, Matrix<N, R, T>>>(
+				std::move(lhs), std::move(rhs));
+
+		return runAsync([operands, token] () {
+			return multiply(operands->first, operands->second, token);
+		}, token);
+	}
+
+	//
+	// multiplyAsync (const Task<Matrix<M, N, T>>&, const Task<Matrix<N, R, T>>&) -> Task<Matrix<M, R, T>>
+	//
+	template <int M, int N, int R, typename T>
+	Task<Matrix<M, R, T>> multiplyAsync(const Task<Matrix<M, N, T>>& lhs,
+			const Task<Matrix<N, R, T>>& rhs) {
+		Task<Matrix<M, R, T>> product(lhs.getToken().child());
+		CancellationToken token = product.getToken();
+
+		joinInto(lhs, rhs, product, [token] (const Matrix<M, N, T>& left, const Matrix<N, R, T>& right) {
+			return multiply(left, right, token);
+		});
+		return product;
+	}
+
+	//
+	// toStringAsync (Matrix<M, N, T>, CancellationToken) -> Task<std::string>
+	//
+	template <int M, int N, typename T>
+	Task<std::string> toStringAsync(Matrix<M, N, T> m, CancellationToken token) {
+		auto operand = std::make_shared<Matrix<M, N, T>>(std::move(m));
+
+		return runAsync([operand] () {
+			return static_cast<std::string>(*operand);
+		}, std::move(token));
+	}
+
+	//
+	// toJSONAsync (Matrix<M, N, T>, CancellationToken) -> Task<json::JSON>
+	//
+	template <int M, int N, typename T>
+	Task<json::JSON> toJSONAsync(Matrix<M, N, T> m, CancellationToken token) {
+		auto operand = std::make_shared<Matrix<M, N, T>>(std::move(m));
+
+		return runAsync([operand] () {
+			return operand->getJSON();
+		}, std::move(token));
+	}
+}
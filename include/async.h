@@ -0,0 +1,280 @@
+/**
+ *  @file		async.h
+ *  @brief	  Define asynchronous versions of the expensive matrix operations
+ *
+ * 	Operations return a Task that completes on the library ThreadPool.
+ * 	Tasks can be chained with then() and join() to build a graph of dependent
+ * 	operations that runs entirely on the pool, without waking the caller
+ * 	between steps.
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-19-2026
+ *  @version	0.1
+ */
+
+#ifndef ASYNC_H
+#define ASYNC_H
+
+#include <memory>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <optional>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include "matrix/matrix.h"
+#include "matrix/thread_pool.h"
+
+namespace matrix {
+
+	/**
+	 * 	@class		OperationCancelled
+	 * 	@brief		Stored in a Task that was cancelled before it could finish
+	 *
+	 */
+	class OperationCancelled : public std::runtime_error {
+		public:
+			OperationCancelled() :
+					std::runtime_error("Operation was cancelled") { }
+	};
+
+	/**
+	 * 	@class		CancellationToken
+	 * 	@brief		Shared flag used to cancel a Task and everything chained from it
+	 *
+	 * 	Copies of a token refer to the same flag.  A child token is cancelled by
+	 * 	its own flag or any of its ancestors', so cancellation only flows down
+	 * 	from a token to its children.
+	 *
+	 */
+	class CancellationToken {
+		public:
+			/// Create a new token that is not cancelled
+			CancellationToken() :
+					flag(std::make_shared<Flag>()) { }
+
+			/// Request cancellation of every task holding this token or a child of it
+			inline void cancel() const { this->flag->cancelled.store(true); }
+
+			/// Check if cancellation has been requested of this token or an ancestor
+			inline bool isCancelled() const {
+				for(const Flag* flag = this->flag.get(); flag; flag = flag->parent.get()) {
+					if(flag->cancelled.load())
+						return true;
+				}
+				return false;
+			}
+
+			/// Create a token cancelled along with this one, that can be cancelled on its own
+			inline CancellationToken child() const {
+				CancellationToken child;
+				child.flag->parent = this->flag;
+				return child;
+			}
+
+		private:
+			/// Flag shared between copies, linked to the flag of the parent token
+			struct Flag {
+				std::atomic<bool> cancelled{false};
+				std::shared_ptr<const Flag> parent;
+			};
+
+			/// Flag of this token
+			std::shared_ptr<Flag> flag;
+	};
+
+	/**
+	 * 	@class		Task
+	 * 	@brief		Handle to the result of an operation running on the ThreadPool
+	 *
+	 * 	Copies of a Task refer to the same result.
+	 * 	Cancellation is checked before a task starts, and by long operations such
+	 * 	as multiplyAsync() while they run; a cancelled task, and every task
+	 * 	chained from it, completes with OperationCancelled.
+	 * 	Tasks chained with then() or join() hold a child of their input's token,
+	 * 	so cancelling them leaves the input and other chains running.
+	 * 	Blocking on get() from inside a pool worker can deadlock, chain with then() instead.
+	 *
+	 */
+	template <typename T>
+	class Task {
+		static_assert(!std::is_void<T>::value, "Task requires a result type");
+
+		public:
+			/// Result type of the task
+			using ValueType = T;
+
+			/**
+			 * 	@brief	Create a task that will complete once fulfilled by the library
+			 *
+			 * 	@param	CancellationToken		Token checked before the task runs
+			 *
+			 * 	@version	0.1
+			 */
+			explicit Task(CancellationToken token = CancellationToken());
+
+			/**
+			 * 	@brief	Block until the task completes, and return its result
+			 *
+			 * 	Rethrows the exception the operation completed with
+			 *
+			 * 	@return	  const T&		Result, valid as long as a copy of this Task exists
+			 *
+			 * 	@version	0.1
+			 */
+			const T& get() const;
+
+			/// Block until the task completes
+			void wait() const;
+
+			/// Check if the task has completed, without blocking
+			bool isReady() const;
+
+			/// Cancel this task and every task chained from it
+			inline void cancel() const { this->state->token.cancel(); }
+
+			/// Get the token that cancels this task
+			inline const CancellationToken& getToken() const { return this->state->token; }
+
+			/**
+			 * 	@brief	Schedule function on the pool once this task has completed
+			 *
+			 * 	Function is called with the result (const T&), errors and
+			 * 	cancellation flow through to the returned task without calling it
+			 *
+			 * 	@param	Function					Continuation taking const T&
+			 * 	@return	  Task<result of Function>	Task completing with the continuation's result
+			 *
+			 * 	@version	0.1
+			 */
+			template <typename Function>
+			auto then(Function function) const -> Task<std::invoke_result_t<Function, const T&>>;
+
+			/**
+			 * 	@brief	Complete the task with a value and schedule its continuations
+			 *
+			 * 	@version	0.1
+			 */
+			void setValue(T value) const;
+
+			/**
+			 * 	@brief	Complete the task with an exception and schedule its continuations
+			 *
+			 * 	@version	0.1
+			 */
+			void setException(std::exception_ptr error) const;
+
+			/**
+			 * 	@brief	Run callback on the pool once the task has completed
+			 *
+			 * 	Runs it right away (still on the pool) if the task has already completed
+			 *
+			 * 	@version	0.1
+			 */
+			void onComplete(std::function<void()> callback) const;
+
+		private:
+			/// State shared between the copies of a Task
+			struct State {
+				std::mutex mutex;
+				std::condition_variable completed;
+				bool finished = false;
+				std::optional<T> value;
+				std::exception_ptr error;
+				std::vector<std::function<void()>> continuations;
+				CancellationToken token;
+			};
+
+			/// Shared result and continuations
+			std::shared_ptr<State> state;
+
+			/// Mark the state finished and post the waiting continuations
+			void finish(std::unique_lock<std::mutex>& lock) const;
+	};
+
+	/**
+	 * 	@brief	Run function on the pool and return a Task to its result
+	 *
+	 * 	@param	Function				Callable taking no arguments
+	 * 	@param	CancellationToken		Token checked before function runs
+	 * 	@return	  Task<result of Function>
+	 *
+	 * 	@version	0.1
+	 */
+	template <typename Function>
+	auto runAsync(Function function, CancellationToken token = CancellationToken())
+			-> Task<std::invoke_result_t<Function>>;
+
+	/**
+	 * 	@brief	Schedule function once both tasks have completed
+	 *
+	 * 	The joined task uses a child of the token of lhs, is cancelled by either input's token,
+	 * 	and fails with the first error of either input
+	 *
+	 * 	@param	const Task<A>&				First dependency
+	 * 	@param	const Task<B>&				Second dependency
+	 * 	@param	Function						Callable taking (const A&, const B&)
+	 * 	@return	  Task<result of Function>
+	 *
+	 * 	@version	0.1
+	 */
+	template <typename A, typename B, typename Function>
+	auto join(const Task<A>& lhs, const Task<B>& rhs, Function function)
+			-> Task<std::invoke_result_t<Function, const A&, const B&>>;
+
+	/// As join(), completing a task the caller created, so function can hold its token
+	template <typename A, typename B, typename Result, typename Function>
+	void joinInto(const Task<A>& lhs, const Task<B>& rhs, const Task<Result>& joined, Function function);
+
+	/**
+	 * 	@brief	Multiply two matrices across the pool, stopping once token is cancelled
+	 *
+	 * 	The token is checked before each band of rows, so even a long product
+	 * 	stops soon after cancellation
+	 *
+	 * 	@throws   OperationCancelled		If token was cancelled before the product finished
+	 *
+	 * 	@version	0.1
+	 */
+	template <int M, int N, int R, typename T>
+	Matrix<M, R, T> multiply(const Matrix<M, N, T>& lhs, const Matrix<N, R, T>& rhs,
+			const CancellationToken& token);
+
+	/**
+	 * 	@brief	Multiply two matrices on the pool
+	 *
+	 * 	Operands are taken by value so the caller is free to modify (or move) its own.
+	 * 	The product fans out across the pool, and stops part way when cancelled.
+	 *
+	 * 	@version	0.2
+	 */
+	template <int M, int N, int R, typename T>
+	Task<Matrix<M, R, T>> multiplyAsync(Matrix<M, N, T> lhs, Matrix<N, R, T> rhs,
+			CancellationToken token = CancellationToken());
+
+	/**
+	 * 	@brief	Multiply the results of two tasks once both are ready
+	 *
+	 * 	@version	0.1
+	 */
+	template <int M, int N, int R, typename T>
+	Task<Matrix<M, R, T>> multiplyAsync(const Task<Matrix<M, N, T>>& lhs,
+			const Task<Matrix<N, R, T>>& rhs);
+
+	/// Convert a matrix to its string form on the pool
+	template <int M, int N, typename T>
+	Task<std::string> toStringAsync(Matrix<M, N, T> m,
+			CancellationToken token = CancellationToken());
+
+	/// Convert a matrix to its JSON form on the pool
+	template <int M, int N, typename T>
+	Task<json::JSON> toJSONAsync(Matrix<M, N, T> m,
+			CancellationToken token = CancellationToken());
+}
+
+#include "matrix/async.cpp"
+
+#endif
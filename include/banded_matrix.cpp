@@ -0,0 +1,120 @@
+/**
+ *  @file		banded_matrix.cpp
+ *  @brief	  Implement the template code for a banded matrix
+ *
+ * 	Details
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-19-2026
+ *  @version	0.1
+ */
+
+#include "banded_matrix.h"
+
+namespace matrix {
+	//
+	// Fill Constructor
+	//
+	template <int N, int KL, int KU, typename T>
+	BandedMatrix<N, KL, KU, T>::BandedMatrix(T value) :
+			band(static_cast<std::size_t>(N) * WIDTH, value) {
+
+	}
+
+	//
+	// Dense Constructor
+	//
+	template <int N, int KL, int KU, typename T>
+	BandedMatrix<N, KL, KU, T>::BandedMatrix(const Matrix<N, N, T>& dense) :
+			band(static_cast<std::size_t>(N) * WIDTH) {
+		for(int row = 0; row < N; ++row) {
+			for(int column = firstColumn(row); column < lastColumn(row); ++column)
+				this->band[index(row, column)] = dense[row][column];
+		}
+	}
+
+	//
+	// get (int, int) -> T
+	//
+	template <int N, int KL, int KU, typename T>
+	T BandedMatrix<N, KL, KU, T>::get(int row, int column) const {
+		if(row < 0 || row >= N || column < 0 || column >= N)
+			throw std::out_of_range("Index must be within the matrix");
+
+		return contains(row, column) ? this->band[index(row, column)] : T();
+	}
+
+	//
+	// set (int, int, const T&) -> void
+	//
+	template <int N, int KL, int KU, typename T>
+	void BandedMatrix<N, KL, KU, T>::set(int row, int column, const T& value) {
+		if(row < 0 || row >= N || column < 0 || column >= N || !contains(row, column))
+			throw std::out_of_range("Index must be within the band");
+
+		this->band[index(row, column)] = value;
+	}
+
+	//
+	// operator * (const Matrix<N, R, T>&) -> Matrix<N, R, T>
+	//
+	template <int N, int KL, int KU, typename T>
+	template <int R>
+	Matrix<N, R, T> BandedMatrix<N, KL, KU, T>::operator * (const Matrix<N, R, T>& rhs) const {
+		Matrix<N, R, T> result;
+
+		kernels::forRows(N, WIDTH * R, [&] (int begin, int end) {
+			for(int row = begin; row < end; ++row) {
+				T* out = result[row].data();
+				for(int k = firstColumn(row); k < lastColumn(row); ++k) {
+					const T scalar = this->band[index(row, k)];
+					const T* right = rhs[k].data();
+					for(int column = 0; column < R; ++column)
+						out[column] += scalar * right[column];
+				}
+			}
+		});
+
+		return result;
+	}
+
+	//
+	// toDense () -> Matrix<N, N, T>
+	//
+	template <int N, int KL, int KU, typename T>
+	Matrix<N, N, T> BandedMatrix<N, KL, KU, T>::toDense() const {
+		Matrix<N, N, T> result;
+		for(int row = 0; row < N; ++row) {
+			for(int column = firstColumn(row); column < lastColumn(row); ++column)
+				result[row][column] = this->band[index(row, column)];
+		}
+
+		return result;
+	}
+
+	//
+	// operator * (const Matrix<M, N, T>&, const BandedMatrix<N, KL, KU, T>&) -> Matrix<M, N, T>
+	//
+	template <int M, int N, int KL, int KU, typename T>
+	Matrix<M, N, T> operator * (const Matrix<M, N, T>& lhs, const BandedMatrix<N, KL, KU, T>& rhs) {
+		using Banded = BandedMatrix<N, KL, KU, T>;
+		Matrix<M, N, T> result;
+		const T* band = rhs.getBand().data();
+
+		kernels::forRows(M, static_cast<long long>(N) * Banded::WIDTH, [&] (int begin, int end) {
+			for(int row = begin; row < end; ++row) {
+				T* out = result[row].data();
+				const T* left = lhs[row].data();
+				for(int k = 0; k < N; ++k) {
+					const T scalar = left[k];
+					const int first = Banded::firstColumn(k);
+					const T* stored = band + Banded::index(k, first) - first;
+					for(int column = first; column < Banded::lastColumn(k); ++column)
+						out[column] += scalar * stored[column];
+				}
+			}
+		});
+
+		return result;
+	}
+}
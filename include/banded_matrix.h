@@ -0,0 +1,128 @@
+/**
+ *  @file		banded_matrix.h
+ *  @brief	  Define a square matrix that only stores the diagonals of its band
+ *
+ * 	Products with a dense Matrix (a matrix-vector product when it has one
+ * 	column) cost O(n (KL + KU + 1)) per column instead of O(n^2)
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-19-2026
+ *  @version	0.1
+ */
+
+#ifndef BANDED_MATRIX_H
+#define BANDED_MATRIX_H
+
+#include <vector>
+#include <stdexcept>
+#include <algorithm>
+
+#include "matrix/matrix.h"
+
+namespace matrix {
+
+	/**
+	 * 	@class		BandedMatrix
+	 * 	@brief		N x N matrix with KL diagonals below the main one and KU above
+	 *
+	 * 	Stores KL + KU + 1 entries per row, (row, column) is at
+	 * 	row * WIDTH + column - row + KL; the slots past the corners are unused
+	 *
+	 */
+	template <int N = 3, int KL = 1, int KU = 1, typename T = double>
+	class BandedMatrix {
+		static_assert(KL >= 0 && KU >= 0, "Band widths can't be negative");
+
+		public:
+			/// Number of stored entries per row
+			static constexpr int WIDTH = KL + KU + 1;
+
+			/**
+			 * 	@brief	Fill Constructor
+			 *
+			 * 	Fills the band with the value provided
+			 *
+			 * 	@version	0.1
+			 */
+			explicit BandedMatrix(T value = T());
+
+			/**
+			 * 	@brief	Build from the band of a dense matrix
+			 *
+			 * 	Entries outside of the band are ignored
+			 *
+			 * 	@version	0.1
+			 */
+			explicit BandedMatrix(const Matrix<N, N, T>& dense);
+
+			/// Check if (row, column) is inside the band
+			static inline bool contains(int row, int column) {
+				return column - row <= KU && row - column <= KL;
+			}
+
+			/// Get the entry at (row, column), T() outside of the band
+			T get(int row, int column) const;
+
+			/**
+			 * 	@brief	Set the entry at (row, column)
+			 *
+			 * 	@throws   std::out_of_range		If (row, column) is outside of the band
+			 *
+			 * 	@version	0.1
+			 */
+			void set(int row, int column, const T& value);
+
+			/**
+			 * 	@brief	Multiply with a dense matrix, only visiting the band
+			 *
+			 * 	@version	0.1
+			 */
+			template <int R>
+			Matrix<N, R, T> operator * (const Matrix<N, R, T>& rhs) const;
+
+			/// Build the dense form of the matrix
+			Matrix<N, N, T> toDense() const;
+
+			/// Get the stored band, WIDTH entries per row
+			inline const std::vector<T>& getBand() const { return this->band; }
+
+			/// Get the width of the Matrix
+			inline int getWidth() const { return N; }
+
+			/// Get the number of rows in the matrix
+			inline int getHeight() const { return N; }
+
+			/// First column of a row inside the band
+			static inline int firstColumn(int row) { return std::max(0, row - KL); }
+
+			/// One past the last column of a row inside the band
+			static inline int lastColumn(int row) { return std::min(N, row + KU + 1); }
+
+			/// Index into band of (row, column), which must be in the band
+			static inline std::size_t index(int row, int column) {
+				return static_cast<std::size_t>(row) * WIDTH + (column - row + KL);
+			}
+
+		private:
+			/// WIDTH entries for each row
+			std::vector<T> band;
+	};
+
+	/**
+	 * 	@brief	Multiply a dense matrix with a banded one, only visiting the band
+	 *
+	 * 	Row k of rhs only adds into the columns of its band, stored contiguously
+	 *
+	 * 	@param	const Matrix<M, N, T>&					Left hand side
+	 * 	@param	const BandedMatrix<N, KL, KU, T>&		Right hand side
+	 * 	@return	  Matrix<M, N, T>							The product, O(M N (KL + KU + 1))
+	 *
+	 * 	@version	0.1
+	 */
+	template <int M, int N, int KL, int KU, typename T>
+	Matrix<M, N, T> operator * (const Matrix<M, N, T>& lhs, const BandedMatrix<N, KL, KU, T>& rhs);
+}
+
+#include "matrix/banded_matrix.cpp"
+
+#endif
@@ -0,0 +1,91 @@
+/**
+ *  @file		comparison.cpp
+ *  @brief	  Implement the template code for tolerance based comparison
+ *
+ * 	Details
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-19-2026
+ *  @version	0.1
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#include "comparison.h"
+
+namespace matrix {
+	//
+	// ulpDistance (T, T) -> std::uint64_t
+	//
+	template <typename T>
+	std::uint64_t ulpDistance(T a, T b) {
+		if constexpr(std::is_floating_point<T>::value) {
+			static_assert(sizeof(T) == 4 || sizeof(T) == 8, "ulpDistance supports float and double");
+			using Bits = std::conditional_t<sizeof(T) == 4, std::int32_t, std::int64_t>;
+
+			if(std::isnan(a) || std::isnan(b))
+				return std::numeric_limits<std::uint64_t>::max();
+
+			// Map the sign-magnitude bits onto a line ordered like the values,
+			// where -0 and +0 meet at 0
+			auto ordered = [] (T value) {
+				Bits bits;
+				std::memcpy(&bits, &value, sizeof(T));
+				return bits < 0 ? static_cast<std::int64_t>(std::numeric_limits<Bits>::min()) - bits
+						: static_cast<std::int64_t>(bits);
+			};
+			std::int64_t left = ordered(a), right = ordered(b);
+			return left > right ? static_cast<std::uint64_t>(left) - static_cast<std::uint64_t>(right)
+					: static_cast<std::uint64_t>(right) - static_cast<std::uint64_t>(left);
+		}
+		else {
+			// Subtract in the unsigned type, a - b may overflow T for values far apart
+			std::uint64_t left = static_cast<std::uint64_t>(a), right = static_cast<std::uint64_t>(b);
+			return a > b ? left - right : right - left;
+		}
+	}
+
+	//
+	// approxEqual (const Matrix<M, N, T>&, const Matrix<M, N, T>&, double) -> bool
+	//
+	template <Tolerance C, int M, int N, typename T>
+	bool approxEqual(const Matrix<M, N, T>& lhs, const Matrix<M, N, T>& rhs, double tolerance) {
+		auto within = [tolerance] (const T& a, const T& b) {
+			if(a == b)
+				return true;
+
+			if constexpr(C == Tolerance::Ulps)
+				return static_cast<double>(ulpDistance(a, b)) <= tolerance;
+			else {
+				double left = static_cast<double>(a), right = static_cast<double>(b);
+				double difference = std::abs(left - right);
+				if constexpr(C == Tolerance::Absolute)
+					return difference <= tolerance;
+				else
+					return difference <= tolerance * std::max(std::abs(left), std::abs(right));
+			}
+		};
+
+		// Rows are checked independently, a mismatch stops the remaining rows
+		std::atomic<bool> equal(true);
+		kernels::forRows(M, N, [&] (int begin, int end) {
+			for(int row = begin; row < end && equal.load(std::memory_order_relaxed); ++row) {
+				const T* left = lhs[row].data();
+				const T* right = rhs[row].data();
+
+				// No early exit inside the row so the comparison vectorizes
+				bool same = true;
+				for(int column = 0; column < N; ++column)
+					same &= within(left[column], right[column]);
+				if(!same)
+					equal.store(false, std::memory_order_relaxed);
+			}
+		});
+
+		return equal.load();
+	}
+}
@@ -0,0 +1,61 @@
+/**
+ *  @file		comparison.h
+ *  @brief	  Define tolerance based comparison of matrices
+ *
+ * 	operator== compares exactly, which rarely suits floating point results.
+ * 	approxEqual() accepts values within an absolute, relative or ULP distance.
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-19-2026
+ *  @version	0.1
+ */
+
+#ifndef COMPARISON_H
+#define COMPARISON_H
+
+#include <cstdint>
+#include <type_traits>
+
+#include "matrix/matrix.h"
+
+namespace matrix {
+
+	/**
+	 * 	@brief	How approxEqual() measures the distance between two values
+	 *
+	 * 	Absolute: |a - b| <= tolerance
+	 * 	Relative: |a - b| <= tolerance * max(|a|, |b|)
+	 * 	Ulps: a and b are at most tolerance representable values apart
+	 *
+	 * 	Values that compare equal always match, NaN never does
+	 */
+	enum class Tolerance { Absolute, Relative, Ulps };
+
+	/**
+	 * 	@brief	Compare two matrices value by value within a tolerance
+	 *
+	 * 	@param	const Matrix<M, N, T>&		Left side
+	 * 	@param	const Matrix<M, N, T>&		Right side
+	 * 	@param	double							Allowed distance, a count of values for Ulps
+	 * 	@return	  bool							If every pair of values is within tolerance
+	 *
+	 * 	@version	0.1
+	 */
+	template <Tolerance C = Tolerance::Relative, int M, int N, typename T>
+	bool approxEqual(const Matrix<M, N, T>& lhs, const Matrix<M, N, T>& rhs, double tolerance);
+
+	/**
+	 * 	@brief	Number of representable values between a and b
+	 *
+	 * 	For floating point, +0 and -0 are 0 apart and NaN is as far as possible
+	 * 	from everything.  For integers it is the difference.
+	 *
+	 * 	@version	0.1
+	 */
+	template <typename T>
+	std::uint64_t ulpDistance(T a, T b);
+}
+
+#include "matrix/comparison.cpp"
+
+#endif
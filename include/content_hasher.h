@@ -0,0 +1,66 @@
+/**
+ *  @file		content_hasher.h
+ *  @brief	  Define a streaming XXH64 hash over bytes
+ *
+ * 	Details
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-19-2026
+ *  @version	0.1
+ */
+
+#ifndef CONTENT_HASHER_H
+#define CONTENT_HASHER_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace matrix {
+
+	/**
+	 * 	@class		ContentHasher
+	 * 	@brief		Streaming XXH64 over bytes
+	 *
+	 * 	Feeding bytes in several pieces gives the same digest as feeding them at once
+	 *
+	 */
+	class ContentHasher {
+		public:
+			/// Start a hash with a seed
+			explicit ContentHasher(std::uint64_t seed = 0);
+
+			/**
+			 * 	@brief	Hash the next bytes
+			 *
+			 * 	@param	const void*		Bytes
+			 * 	@param	std::size_t		Number of bytes
+			 *
+			 * 	@version	0.1
+			 */
+			void update(const void* data, std::size_t bytes);
+
+			/// Get the hash of every byte so far, more can be added afterwards
+			std::uint64_t digest() const;
+
+		private:
+			/// Fold a 32 byte stripe into the accumulators
+			void consume(const unsigned char* stripe);
+
+			/// Seed the hash started with
+			std::uint64_t seed;
+
+			/// Four lanes of accumulated stripes
+			std::uint64_t lanes[4];
+
+			/// Bytes waiting for a full stripe
+			unsigned char buffer[32];
+
+			/// Number of bytes in buffer
+			std::size_t buffered;
+
+			/// Number of bytes hashed
+			std::uint64_t total;
+	};
+}
+
+#endif
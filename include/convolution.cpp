@@ -0,0 +1,335 @@
+/**
+ *  @file		convolution.cpp
+ *  @brief	  Implement the template code for 2D convolution and correlation
+ *
+ * 	Details
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-19-2026
+ *  @version	0.1
+ */
+
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+
+#include "convolution.h"
+
+namespace matrix {
+	namespace convolution {
+		/// Lowest output index whose tap at offset lands at or after input 0
+		inline int firstValid(int offset, int stride) {
+			return offset >= 0 ? 0 : (-offset + stride - 1) / stride;
+		}
+
+		/// One past the highest output index whose tap at offset lands before input length
+		inline int endValid(int offset, int stride, int length, int outputs) {
+			if(offset >= length)
+				return 0;
+			return std::min(outputs, (length - 1 - offset) / stride + 1);
+		}
+
+		/**
+		 * 	@brief	Accumulate each kernel tap as a multiply-add across an output row
+		 *
+		 * 	Work is one output row of one output channel, so output channels and rows
+		 * 	are spread across the ThreadPool together
+		 */
+		template <int S, int P, int D, int M, int N, int KH, int KW, int OM, int ON, typename T>
+		void direct(const std::vector<Matrix<M, N, T>>& input,
+				const std::vector<std::vector<Matrix<KH, KW, T>>>& filters,
+				std::vector<Matrix<OM, ON, T>>& output) {
+			const int channels = static_cast<int>(input.size());
+			const int outputChannels = static_cast<int>(filters.size());
+
+			kernels::forRows(outputChannels * OM, channels * KH * KW * ON, [&] (int begin, int end) {
+				for(int unit = begin; unit < end; ++unit) {
+					int channel = unit / OM, y = unit % OM;
+					T* out = output[channel][y].data();
+
+					for(int c = 0; c < channels; ++c) {
+						const Matrix<KH, KW, T>& kernel = filters[channel][c];
+						for(int i = 0; i < KH; ++i) {
+							int inputRow = y * S - P + i * D;
+							if(inputRow < 0 || inputRow >= M)
+								continue;
+							const T* in = input[c][inputRow].data();
+
+							for(int j = 0; j < KW; ++j) {
+								const T weight = kernel[i][j];
+								const int offset = j * D - P;
+								const int xEnd = endValid(offset, S, N, ON);
+								for(int x = firstValid(offset, S); x < xEnd; ++x)
+									out[x] += weight * in[x * S + offset];
+							}
+						}
+					}
+				}
+			});
+		}
+
+		/**
+		 * 	@brief	Unroll every input patch into a column and multiply by the filters with GEMM
+		 *
+		 * 	The column matrix is (channels * KH * KW) x (OM * ON) and the filters form
+		 * 	an outputChannels x (channels * KH * KW) matrix, so the product rows are the
+		 * 	output channels and parallelGemm() splits them across the ThreadPool
+		 */
+		template <int S, int P, int D, int M, int N, int KH, int KW, int OM, int ON, typename T>
+		void im2col(const std::vector<Matrix<M, N, T>>& input,
+				const std::vector<std::vector<Matrix<KH, KW, T>>>& filters,
+				std::vector<Matrix<OM, ON, T>>& output) {
+			const int channels = static_cast<int>(input.size());
+			const int outputChannels = static_cast<int>(filters.size());
+			const int patch = channels * KH * KW;
+			const int positions = OM * ON;
+
+			// Each row of columns is one tap of one channel at every output position
+			std::vector<T> columns(static_cast<std::size_t>(patch) * positions);
+			kernels::forRows(patch, positions, [&] (int begin, int end) {
+				for(int row = begin; row < end; ++row) {
+					int c = row / (KH * KW), i = (row / KW) % KH, j = row % KW;
+					T* out = columns.data() + static_cast<std::size_t>(row) * positions;
+					const int offset = j * D - P;
+					const int xBegin = firstValid(offset, S), xEnd = endValid(offset, S, N, ON);
+
+					for(int y = 0; y < OM; ++y, out += ON) {
+						int inputRow = y * S - P + i * D;
+						if(inputRow < 0 || inputRow >= M || xBegin >= xEnd) {
+							std::fill(out, out + ON, T());
+							continue;
+						}
+						const T* in = input[c][inputRow].data();
+						std::fill(out, out + xBegin, T());
+						for(int x = xBegin; x < xEnd; ++x)
+							out[x] = in[x * S + offset];
+						std::fill(out + xEnd, out + ON, T());
+					}
+				}
+			});
+
+			std::vector<T> weights(static_cast<std::size_t>(outputChannels) * patch);
+			for(int channel = 0; channel < outputChannels; ++channel) {
+				T* out = weights.data() + static_cast<std::size_t>(channel) * patch;
+				for(int c = 0; c < channels; ++c) {
+					for(int i = 0; i < KH; ++i, out += KW)
+						std::copy(filters[channel][c][i].begin(), filters[channel][c][i].end(), out);
+				}
+			}
+
+			std::vector<T> product(static_cast<std::size_t>(outputChannels) * positions);
+			std::vector<const T*> weightRows(outputChannels), columnRows(patch);
+			std::vector<T*> productRows(outputChannels);
+			for(int channel = 0; channel < outputChannels; ++channel) {
+				weightRows[channel] = weights.data() + static_cast<std::size_t>(channel) * patch;
+				productRows[channel] = product.data() + static_cast<std::size_t>(channel) * positions;
+			}
+			for(int row = 0; row < patch; ++row)
+				columnRows[row] = columns.data() + static_cast<std::size_t>(row) * positions;
+
+			kernels::parallelGemm<T>(weightRows.data(), columnRows.data(), productRows.data(),
+					outputChannels, patch, positions);
+
+			// Fold the flat product rows back into the output matrices
+			kernels::forRows(outputChannels * OM, ON, [&] (int begin, int end) {
+				for(int unit = begin; unit < end; ++unit) {
+					int channel = unit / OM, y = unit % OM;
+					const T* from = productRows[channel] + static_cast<std::size_t>(y) * ON;
+					std::copy(from, from + ON, output[channel][y].begin());
+				}
+			});
+		}
+
+		/**
+		 * 	@brief	Winograd F(2x2, 3x3) for stride 1, dilation 1
+		 *
+		 * 	Each 2x2 block of outputs is A^T [sum over c of (G g G^T) . (B^T d B)] A,
+		 * 	with g a kernel and d the 4x4 input tile under the block.  Kernels and tiles
+		 * 	are transformed once, then combined per output channel and row of tiles.
+		 */
+		template <int P, int M, int N, int OM, int ON, typename T>
+		void winograd(const std::vector<Matrix<M, N, T>>& input,
+				const std::vector<std::vector<Matrix<3, 3, T>>>& filters,
+				std::vector<Matrix<OM, ON, T>>& output) {
+			const int channels = static_cast<int>(input.size());
+			const int outputChannels = static_cast<int>(filters.size());
+			constexpr int TILE_ROWS = (OM + 1) / 2, TILE_COLUMNS = (ON + 1) / 2;
+
+			// U = G g G^T for every pair of channels
+			std::vector<T> transformedKernels(static_cast<std::size_t>(outputChannels) * channels * 16);
+			for(int channel = 0; channel < outputChannels; ++channel) {
+				for(int c = 0; c < channels; ++c) {
+					const Matrix<3, 3, T>& g = filters[channel][c];
+					T* u = transformedKernels.data() + (static_cast<std::size_t>(channel) * channels + c) * 16;
+
+					T h[4][3];
+					for(int j = 0; j < 3; ++j) {
+						h[0][j] = g[0][j];
+						h[1][j] = (g[0][j] + g[1][j] + g[2][j]) / T(2);
+						h[2][j] = (g[0][j] - g[1][j] + g[2][j]) / T(2);
+						h[3][j] = g[2][j];
+					}
+					for(int i = 0; i < 4; ++i) {
+						u[i * 4 + 0] = h[i][0];
+						u[i * 4 + 1] = (h[i][0] + h[i][1] + h[i][2]) / T(2);
+						u[i * 4 + 2] = (h[i][0] - h[i][1] + h[i][2]) / T(2);
+						u[i * 4 + 3] = h[i][2];
+					}
+				}
+			}
+
+			// V = B^T d B for every tile of every input channel
+			std::vector<T> transformedTiles(static_cast<std::size_t>(channels) * TILE_ROWS * TILE_COLUMNS * 16);
+			kernels::forRows(channels * TILE_ROWS, TILE_COLUMNS * 16, [&] (int begin, int end) {
+				for(int unit = begin; unit < end; ++unit) {
+					int c = unit / TILE_ROWS, tileRow = unit % TILE_ROWS;
+					T* v = transformedTiles.data() + static_cast<std::size_t>(unit) * TILE_COLUMNS * 16;
+
+					for(int tileColumn = 0; tileColumn < TILE_COLUMNS; ++tileColumn, v += 16) {
+						T d[4][4];
+						for(int i = 0; i < 4; ++i) {
+							int inputRow = tileRow * 2 - P + i;
+							for(int j = 0; j < 4; ++j) {
+								int inputColumn = tileColumn * 2 - P + j;
+								d[i][j] = (inputRow < 0 || inputRow >= M || inputColumn < 0 || inputColumn >= N)
+										? T() : input[c][inputRow][inputColumn];
+							}
+						}
+
+						T t[4][4];
+						for(int j = 0; j < 4; ++j) {
+							t[0][j] = d[0][j] - d[2][j];
+							t[1][j] = d[1][j] + d[2][j];
+							t[2][j] = d[2][j] - d[1][j];
+							t[3][j] = d[1][j] - d[3][j];
+						}
+						for(int i = 0; i < 4; ++i) {
+							v[i * 4 + 0] = t[i][0] - t[i][2];
+							v[i * 4 + 1] = t[i][1] + t[i][2];
+							v[i * 4 + 2] = t[i][2] - t[i][1];
+							v[i * 4 + 3] = t[i][1] - t[i][3];
+						}
+					}
+				}
+			});
+
+			// Y = A^T m A, where m is the elementwise product summed over input channels
+			kernels::forRows(outputChannels * TILE_ROWS, channels * TILE_COLUMNS * 16, [&] (int begin, int end) {
+				for(int unit = begin; unit < end; ++unit) {
+					int channel = unit / TILE_ROWS, tileRow = unit % TILE_ROWS;
+					int y = tileRow * 2;
+
+					for(int tileColumn = 0; tileColumn < TILE_COLUMNS; ++tileColumn) {
+						T m[16] = {};
+						for(int c = 0; c < channels; ++c) {
+							const T* u = transformedKernels.data() + (static_cast<std::size_t>(channel) * channels + c) * 16;
+							const T* v = transformedTiles.data()
+									+ ((static_cast<std::size_t>(c) * TILE_ROWS + tileRow) * TILE_COLUMNS + tileColumn) * 16;
+							for(int k = 0; k < 16; ++k)
+								m[k] += u[k] * v[k];
+						}
+
+						T t[2][4];
+						for(int j = 0; j < 4; ++j) {
+							t[0][j] = m[j] + m[4 + j] + m[8 + j];
+							t[1][j] = m[4 + j] - m[8 + j] - m[12 + j];
+						}
+
+						int x = tileColumn * 2;
+						for(int i = 0; i < 2 && y + i < OM; ++i) {
+							T* out = output[channel][y + i].data();
+							out[x] = t[i][0] + t[i][1] + t[i][2];
+							if(x + 1 < ON)
+								out[x + 1] = t[i][1] - t[i][2] - t[i][3];
+						}
+					}
+				}
+			});
+		}
+	}
+
+	//
+	// correlate2d (const std::vector<Matrix<M, N, T>>&,
+	// const std::vector<std::vector<Matrix<KH, KW, T>>>&, ConvolutionMethod) -> std::vector<Convolved<...>>
+	//
+	template <int S, int P, int D, int M, int N, int KH, int KW, typename T>
+	std::vector<Convolved<M, N, KH, KW, S, P, D, T>> correlate2d(
+			const std::vector<Matrix<M, N, T>>& input,
+			const std::vector<std::vector<Matrix<KH, KW, T>>>& filters,
+			ConvolutionMethod method) {
+		static_assert(S > 0 && D > 0 && P >= 0, "stride and dilation must be positive, padding not negative");
+		constexpr int OM = convolvedSize(M, KH, S, P, D), ON = convolvedSize(N, KW, S, P, D);
+		static_assert(OM > 0 && ON > 0, "the dilated kernel must fit in the padded input");
+
+		for(const auto& channelKernels : filters) {
+			if(channelKernels.size() != input.size())
+				throw std::invalid_argument("every output channel needs a kernel per input channel");
+		}
+
+		constexpr bool WINOGRAD = KH == 3 && KW == 3 && S == 1 && D == 1;
+		if(method == ConvolutionMethod::Auto) {
+			if(WINOGRAD && std::is_floating_point<T>::value)
+				method = ConvolutionMethod::Winograd;
+			else {
+				// GEMM only pays for unrolling the input once the patches are deep and
+				// each is reused by many output channels
+				bool deep = input.size() * KH * KW >= 256 && filters.size() >= 16;
+				method = deep ? ConvolutionMethod::Im2col : ConvolutionMethod::Direct;
+			}
+		}
+
+		std::vector<Matrix<OM, ON, T>> output(filters.size());
+		if(input.empty())
+			return output;
+
+		switch(method) {
+			case ConvolutionMethod::Winograd:
+				// The transforms divide by 2, which integers can't represent
+				if constexpr(WINOGRAD && std::is_floating_point<T>::value)
+					convolution::winograd<P>(input, filters, output);
+				else
+					throw std::invalid_argument("Winograd needs a floating point 3x3 kernel with stride and dilation 1");
+				break;
+			case ConvolutionMethod::Im2col:
+				convolution::im2col<S, P, D>(input, filters, output);
+				break;
+			default:
+				convolution::direct<S, P, D>(input, filters, output);
+				break;
+		}
+
+		return output;
+	}
+
+	//
+	// correlate2d (const Matrix<M, N, T>&, const Matrix<KH, KW, T>&, ConvolutionMethod)
+	// -> Convolved<M, N, KH, KW, S, P, D, T>
+	//
+	template <int S, int P, int D, int M, int N, int KH, int KW, typename T>
+	Convolved<M, N, KH, KW, S, P, D, T> correlate2d(const Matrix<M, N, T>& input,
+			const Matrix<KH, KW, T>& kernel, ConvolutionMethod method) {
+		std::vector<Matrix<M, N, T>> channels;
+		channels.push_back(input);
+		std::vector<std::vector<Matrix<KH, KW, T>>> filters(1);
+		filters[0].push_back(kernel);
+
+		return std::move(correlate2d<S, P, D>(channels, filters, method)[0]);
+	}
+
+	//
+	// convolve2d (const Matrix<M, N, T>&, const Matrix<KH, KW, T>&, ConvolutionMethod)
+	// -> Convolved<M, N, KH, KW, S, P, D, T>
+	//
+	template <int S, int P, int D, int M, int N, int KH, int KW, typename T>
+	Convolved<M, N, KH, KW, S, P, D, T> convolve2d(const Matrix<M, N, T>& input,
+			const Matrix<KH, KW, T>& kernel, ConvolutionMethod method) {
+		Matrix<KH, KW, T> flipped;
+		for(int i = 0; i < KH; ++i) {
+			for(int j = 0; j < KW; ++j)
+				flipped[i][j] = kernel[KH - 1 - i][KW - 1 - j];
+		}
+
+		return correlate2d<S, P, D>(input, flipped, method);
+	}
+}
@@ -0,0 +1,102 @@
+/**
+ *  @file		convolution.h
+ *  @brief	  Define 2D convolution and correlation of matrices
+ *
+ * 	Multi-channel correlation, as used by CNN layers, is computed one of three ways:
+ * 		Direct		Loops over the kernel, each tap a multiply-add across an output row
+ * 		Im2col		Unrolls input patches into columns and multiplies by the filters with GEMM
+ * 		Winograd	F(2x2, 3x3), 16 multiplications per 2x2 outputs instead of 36
+ * 	Work is split across the ThreadPool by output channel and output row.
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-19-2026
+ *  @version	0.1
+ */
+
+#ifndef CONVOLUTION_H
+#define CONVOLUTION_H
+
+#include <vector>
+#include <stdexcept>
+#include <type_traits>
+
+#include "matrix/matrix.h"
+
+namespace matrix {
+
+	/**
+	 * 	@brief	How a convolution is computed
+	 *
+	 * 	Auto uses Winograd for floating point 3x3 kernels with stride and dilation 1,
+	 * 	Im2col when there are at least 256 values under each output and at least
+	 * 	16 output channels to share the unrolled input, and Direct otherwise
+	 */
+	enum class ConvolutionMethod { Auto, Direct, Im2col, Winograd };
+
+	/**
+	 * 	@brief	Length of a convolution's output along one side
+	 *
+	 * 	@param	int		Length of the input
+	 * 	@param	int		Length of the kernel
+	 * 	@param	int		Step between outputs
+	 * 	@param	int		Zeros added to both ends of the input
+	 * 	@param	int		Step between kernel taps
+	 *
+	 * 	@version	0.1
+	 */
+	constexpr int convolvedSize(int input, int kernel, int stride, int padding, int dilation) {
+		return (input + 2 * padding - dilation * (kernel - 1) - 1) / stride + 1;
+	}
+
+	/// Output of a convolution of an M x N input with a KH x KW kernel
+	template <int M, int N, int KH, int KW, int S, int P, int D, typename T>
+	using Convolved = Matrix<convolvedSize(M, KH, S, P, D), convolvedSize(N, KW, S, P, D), T>;
+
+	/**
+	 * 	@brief	Correlate channels of input with a kernel per output and input channel
+	 *
+	 * 	output[o][y][x] = sum over c, i, j of
+	 * 		input[c][y * S - P + i * D][x * S - P + j * D] * filters[o][c][i][j]
+	 * 	where input outside the matrix is 0
+	 *
+	 * 	@param	const std::vector<Matrix<M, N, T>>&					Input channels
+	 * 	@param	const std::vector<std::vector<Matrix<KH, KW, T>>>&		Kernels, indexed [output][input]
+	 * 	@param	ConvolutionMethod										How to compute it
+	 * 	@return	  std::vector<Convolved<...>>							Output channels
+	 * 	@throws   std::invalid_argument	If there isn't a kernel for every pair of channels,
+	 * 										or the method can't be used for these parameters
+	 *
+	 * 	@version	0.1
+	 */
+	template <int S = 1, int P = 0, int D = 1, int M, int N, int KH, int KW, typename T>
+	std::vector<Convolved<M, N, KH, KW, S, P, D, T>> correlate2d(
+			const std::vector<Matrix<M, N, T>>& input,
+			const std::vector<std::vector<Matrix<KH, KW, T>>>& filters,
+			ConvolutionMethod method = ConvolutionMethod::Auto);
+
+	/**
+	 * 	@brief	Correlate a single channel with a kernel
+	 *
+	 * 	output[y][x] = sum over i, j of input[y * S - P + i * D][x * S - P + j * D] * kernel[i][j]
+	 *
+	 * 	@version	0.1
+	 */
+	template <int S = 1, int P = 0, int D = 1, int M, int N, int KH, int KW, typename T>
+	Convolved<M, N, KH, KW, S, P, D, T> correlate2d(const Matrix<M, N, T>& input,
+			const Matrix<KH, KW, T>& kernel, ConvolutionMethod method = ConvolutionMethod::Auto);
+
+	/**
+	 * 	@brief	Convolve a single channel with a kernel
+	 *
+	 * 	The same as correlate2d() with the kernel rotated half a turn
+	 *
+	 * 	@version	0.1
+	 */
+	template <int S = 1, int P = 0, int D = 1, int M, int N, int KH, int KW, typename T>
+	Convolved<M, N, KH, KW, S, P, D, T> convolve2d(const Matrix<M, N, T>& input,
+			const Matrix<KH, KW, T>& kernel, ConvolutionMethod method = ConvolutionMethod::Auto);
+}
+
+#include "matrix/convolution.cpp"
+
+#endif
@@ -0,0 +1,118 @@
+/**
+ *  @file		diagonal_matrix.cpp
+ *  @brief	  Implement the template code for a diagonal matrix
+ *
+ * 	Details
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-19-2026
+ *  @version	0.1
+ */
+
+#include "diagonal_matrix.h"
+
+namespace matrix {
+	//
+	// Fill Constructor
+	//
+	template <int N, typename T>
+	DiagonalMatrix<N, T>::DiagonalMatrix(T value) :
+			diagonal(N, value) {
+
+	}
+
+	//
+	// Diagonal Constructor
+	//
+	template <int N, typename T>
+	DiagonalMatrix<N, T>::DiagonalMatrix(std::vector<T> diagonal) :
+			diagonal(std::move(diagonal)) {
+		if(this->diagonal.size() != static_cast<std::size_t>(N))
+			throw std::out_of_range("Diagonal must have N values");
+	}
+
+	//
+	// operator * (const DiagonalMatrix<N, T>&) -> DiagonalMatrix<N, T>
+	//
+	template <int N, typename T>
+	DiagonalMatrix<N, T> DiagonalMatrix<N, T>::operator * (const DiagonalMatrix<N, T>& rhs) const {
+		DiagonalMatrix<N, T> result(*this);
+		for(int i = 0; i < N; ++i)
+			result.diagonal[i] = this->diagonal[i] * rhs.diagonal[i];
+
+		return result;
+	}
+
+	//
+	// operator * (const Matrix<N, R, T>&) -> Matrix<N, R, T>
+	//
+	template <int N, typename T>
+	template <int R>
+	Matrix<N, R, T> DiagonalMatrix<N, T>::operator * (const Matrix<N, R, T>& rhs) const {
+		Matrix<N, R, T> result(rhs);
+
+		// Scale each row of rhs by its entry of the diagonal
+		kernels::forRows(N, R, [&] (int begin, int end) {
+			for(int row = begin; row < end; ++row) {
+				T* out = result[row].data();
+				const T scalar = this->diagonal[row];
+				for(int column = 0; column < R; ++column)
+					out[column] = scalar * out[column];
+			}
+		});
+
+		return result;
+	}
+
+	//
+	// solve (const Matrix<N, R, T>&) -> Matrix<N, R, T>
+	//
+	template <int N, typename T>
+	template <int R>
+	Matrix<N, R, T> DiagonalMatrix<N, T>::solve(const Matrix<N, R, T>& rhs) const {
+		Matrix<N, R, T> result(rhs);
+
+		for(int row = 0; row < N; ++row) {
+			if(this->diagonal[row] == T())
+				throw std::domain_error("Diagonal matrix is singular");
+
+			T* out = result[row].data();
+			for(int column = 0; column < R; ++column)
+				out[column] = out[column] / this->diagonal[row];
+		}
+
+		return result;
+	}
+
+	//
+	// toDense () -> Matrix<N, N, T>
+	//
+	template <int N, typename T>
+	Matrix<N, N, T> DiagonalMatrix<N, T>::toDense() const {
+		Matrix<N, N, T> result;
+		for(int i = 0; i < N; ++i)
+			result[i][i] = this->diagonal[i];
+
+		return result;
+	}
+
+	//
+	// operator * (const Matrix<M, N, T>&, const DiagonalMatrix<N, T>&) -> Matrix<M, N, T>
+	//
+	template <int M, int N, typename T>
+	Matrix<M, N, T> operator * (const Matrix<M, N, T>& lhs, const DiagonalMatrix<N, T>& rhs) {
+		Matrix<M, N, T> result(lhs);
+		const T* scalars = rhs.getDiagonal().data();
+
+		// Scale each column of lhs, walking the rows so access stays contiguous
+		kernels::forRows(M, N, [&] (int begin, int end) {
+			for(int row = begin; row < end; ++row) {
+				T* out = result[row].data();
+				for(int column = 0; column < N; ++column)
+					out[column] = out[column] * scalars[column];
+			}
+		});
+
+		return result;
+	}
+}
@@ -0,0 +1,133 @@
+/**
+ *  @file		diagonal_matrix.h
+ *  @brief	  Define a square matrix that only stores its diagonal
+ *
+ * 	Products with a dense Matrix scale its rows or columns, O(n^2) instead of O(n^3)
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-19-2026
+ *  @version	0.1
+ */
+
+#ifndef DIAGONAL_MATRIX_H
+#define DIAGONAL_MATRIX_H
+
+#include <vector>
+#include <stdexcept>
+
+#include "matrix/matrix.h"
+
+namespace matrix {
+
+	/**
+	 * 	@class		DiagonalMatrix
+	 * 	@brief		N x N matrix that is T() everywhere off of the diagonal
+	 *
+	 * 	Stores the N values of the diagonal
+	 *
+	 */
+	template <int N = 3, typename T = double>
+	class DiagonalMatrix {
+		public:
+			/**
+			 * 	@brief	Fill Constructor
+			 *
+			 * 	Fills the diagonal with the value provided
+			 *
+			 * 	@version	0.1
+			 */
+			explicit DiagonalMatrix(T value = T());
+
+			/**
+			 * 	@brief	Build the matrix from the values of its diagonal
+			 *
+			 * 	@throws   std::out_of_range		If there are not N values
+			 *
+			 * 	@version	0.1
+			 */
+			explicit DiagonalMatrix(std::vector<T> diagonal);
+
+			/**
+			 * 	@brief 	Access an entry of the diagonal
+			 *
+			 * 	@param	unsigned int		Index along the diagonal
+			 * 	@return	  T&					Entry (index, index)
+			 * 	@throws   std::out_of_range
+			 */
+			inline T& operator [] (unsigned int index) {
+				if(index < N)
+					return this->diagonal[index];
+				else
+					throw std::out_of_range("Index must be within the diagonal");
+			}
+
+			/// Access an entry of the diagonal as an r-value
+			inline const T& operator [] (unsigned int index) const {
+				if(index < N)
+					return this->diagonal[index];
+				else
+					throw std::out_of_range("Index must be within the diagonal");
+			}
+
+			/// Get the entry at (row, column), T() off of the diagonal
+			inline T get(int row, int column) const {
+				return (row == column) ? (*this)[row] : T();
+			}
+
+			/// Multiply two diagonal matrices
+			DiagonalMatrix<N, T> operator * (const DiagonalMatrix<N, T>& rhs) const;
+
+			/**
+			 * 	@brief	Multiply with a dense matrix by scaling its rows
+			 *
+			 * 	@param	const Matrix<N, R, T>&	Right hand side
+			 * 	@return	  Matrix<N, R, T>			Row r of rhs scaled by entry r
+			 *
+			 * 	@version	0.1
+			 */
+			template <int R>
+			Matrix<N, R, T> operator * (const Matrix<N, R, T>& rhs) const;
+
+			/**
+			 * 	@brief	Solve this * X = rhs for X
+			 *
+			 * 	@throws   std::domain_error		If an entry of the diagonal is T()
+			 *
+			 * 	@version	0.1
+			 */
+			template <int R>
+			Matrix<N, R, T> solve(const Matrix<N, R, T>& rhs) const;
+
+			/// Build the dense form of the matrix
+			Matrix<N, N, T> toDense() const;
+
+			/// Get the stored diagonal
+			inline const std::vector<T>& getDiagonal() const { return this->diagonal; }
+
+			/// Get the width of the Matrix
+			inline int getWidth() const { return N; }
+
+			/// Get the number of rows in the matrix
+			inline int getHeight() const { return N; }
+
+		private:
+			/// Entries of the diagonal
+			std::vector<T> diagonal;
+	};
+
+	/**
+	 * 	@brief	Multiply a dense matrix with a diagonal one by scaling its columns
+	 *
+	 * 	@param	const Matrix<M, N, T>&				Left hand side
+	 * 	@param	const DiagonalMatrix<N, T>&		Right hand side
+	 * 	@return	  Matrix<M, N, T>						Column c of lhs scaled by entry c
+	 *
+	 * 	@version	0.1
+	 */
+	template <int M, int N, typename T>
+	Matrix<M, N, T> operator * (const Matrix<M, N, T>& lhs, const DiagonalMatrix<N, T>& rhs);
+}
+
+#include "matrix/diagonal_matrix.cpp"
+
+#endif
@@ -0,0 +1,246 @@
+/**
+ *  @file		distributed.cpp
+ *  @brief	  Implement the template code for distributed multiplication
+ *
+ * 	Details
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-19-2026
+ *  @version	0.1
+ */
+
+#include <algorithm>
+#include <cstring>
+
+#include "distributed.h"
+
+namespace matrix {
+	namespace distributed {
+		/// Row pointers into a row-major buffer
+		template <typename T>
+		std::vector<T*> rowsOf(T* data, int rows, int columns) {
+			std::vector<T*> pointers(rows);
+			for(int row = 0; row < rows; ++row)
+				pointers[row] = data + static_cast<std::size_t>(row) * columns;
+			return pointers;
+		}
+
+		/// Index of the part of partition(extent, parts, ...) holding value
+		inline int partOf(int extent, int parts, int value) {
+			for(int part = 0; part < parts; ++part) {
+				if(value < partition(extent, parts, part).second)
+					return part;
+			}
+			return parts - 1;
+		}
+
+		//
+		// summa (Transport&, const ProcessGrid&, int, int, int, const T*, const T*, T*) -> void
+		//
+		template <typename T>
+		void summa(Transport& transport, const ProcessGrid& grid, int rows, int inner, int columns,
+				const T* lhs, const T* rhs, T* result) {
+			static_assert(std::is_trivially_copyable<T>::value,
+					"distributed operations send T as raw bytes, T must be trivially copyable");
+			if(grid.size() != transport.size())
+				throw std::invalid_argument("the process grid must match the number of ranks");
+
+			const int gridRow = grid.rowOf(transport.rank());
+			const int gridColumn = grid.columnOf(transport.rank());
+			const auto localRows = partition(rows, grid.getRows(), gridRow);
+			const auto localColumns = partition(columns, grid.getColumns(), gridColumn);
+			const auto lhsInner = partition(inner, grid.getColumns(), gridColumn);
+			const auto rhsInner = partition(inner, grid.getRows(), gridRow);
+			const int height = localRows.second - localRows.first;
+			const int width = localColumns.second - localColumns.first;
+			const int lhsWidth = lhsInner.second - lhsInner.first;
+
+			// Panels end wherever either side's split of the shared dimension does,
+			// so each panel of lhs lives on one grid column and of rhs on one grid row
+			std::vector<int> breaks = {0, inner};
+			for(int column = 1; column < grid.getColumns(); ++column)
+				breaks.push_back(partition(inner, grid.getColumns(), column).first);
+			for(int row = 1; row < grid.getRows(); ++row)
+				breaks.push_back(partition(inner, grid.getRows(), row).first);
+			std::sort(breaks.begin(), breaks.end());
+			breaks.erase(std::unique(breaks.begin(), breaks.end()), breaks.end());
+
+			int widest = 0;
+			for(std::size_t i = 1; i < breaks.size(); ++i)
+				widest = std::max(widest, breaks[i] - breaks[i - 1]);
+
+			std::vector<T> lhsPanel(static_cast<std::size_t>(height) * widest);
+			std::vector<T> rhsPanel(static_cast<std::size_t>(widest) * width);
+			std::vector<T*> resultRows = rowsOf(result, height, width);
+			const std::vector<int> rowGroup = grid.rowGroup(gridRow);
+			const std::vector<int> columnGroup = grid.columnGroup(gridColumn);
+			const int block = KernelConfig::getInstance().getGemmBlockSize();
+
+			for(std::size_t panel = 1; panel < breaks.size(); ++panel) {
+				const int begin = breaks[panel - 1];
+				const int span = breaks[panel] - begin;
+
+				// Columns [begin, begin + span) of lhs, from the grid column holding them
+				int lhsOwner = partOf(inner, grid.getColumns(), begin);
+				if(lhsOwner == gridColumn) {
+					int offset = begin - lhsInner.first;
+					for(int row = 0; row < height; ++row) {
+						std::memcpy(lhsPanel.data() + static_cast<std::size_t>(row) * span,
+								lhs + static_cast<std::size_t>(row) * lhsWidth + offset, sizeof(T) * span);
+					}
+				}
+				transport.broadcast(rowGroup, grid.rankOf(gridRow, lhsOwner), lhsPanel.data(),
+						sizeof(T) * height * span);
+
+				// Rows [begin, begin + span) of rhs, from the grid row holding them
+				int rhsOwner = partOf(inner, grid.getRows(), begin);
+				if(rhsOwner == gridRow) {
+					int offset = begin - rhsInner.first;
+					std::memcpy(rhsPanel.data(), rhs + static_cast<std::size_t>(offset) * width,
+							sizeof(T) * span * width);
+				}
+				transport.broadcast(columnGroup, grid.rankOf(rhsOwner, gridColumn), rhsPanel.data(),
+						sizeof(T) * span * width);
+
+				std::vector<T*> lhsRows = rowsOf(lhsPanel.data(), height, span);
+				std::vector<T*> rhsRows = rowsOf(rhsPanel.data(), span, width);
+				kernels::gemm<T>(lhsRows.data(), rhsRows.data(), resultRows.data(),
+						0, height, span, width, block);
+			}
+		}
+
+		//
+		// multiplyBlocks (Transport&, const ProcessGrid&, int, int, int, Lhs, Rhs, Product) -> void
+		//
+		template <typename T, typename Lhs, typename Rhs, typename Product>
+		void multiplyBlocks(Transport& transport, const ProcessGrid& grid, int rows, int inner, int columns,
+				Lhs lhs, Rhs rhs, Product product) {
+			if(grid.size() != transport.size())
+				throw std::invalid_argument("the process grid must match the number of ranks");
+
+			const int gridRow = grid.rowOf(transport.rank());
+			const int gridColumn = grid.columnOf(transport.rank());
+			const auto localRows = partition(rows, grid.getRows(), gridRow);
+			const auto localColumns = partition(columns, grid.getColumns(), gridColumn);
+			const auto lhsInner = partition(inner, grid.getColumns(), gridColumn);
+			const auto rhsInner = partition(inner, grid.getRows(), gridRow);
+			const int height = localRows.second - localRows.first;
+			const int width = localColumns.second - localColumns.first;
+			const int lhsWidth = lhsInner.second - lhsInner.first;
+
+			std::vector<T> lhsBlock(static_cast<std::size_t>(height) * lhsWidth);
+			for(int row = 0; row < height; ++row)
+				for(int column = 0; column < lhsWidth; ++column)
+					lhsBlock[static_cast<std::size_t>(row) * lhsWidth + column] =
+							lhs(localRows.first + row, lhsInner.first + column);
+
+			std::vector<T> rhsBlock(static_cast<std::size_t>(rhsInner.second - rhsInner.first) * width);
+			for(int row = 0; row < rhsInner.second - rhsInner.first; ++row)
+				for(int column = 0; column < width; ++column)
+					rhsBlock[static_cast<std::size_t>(row) * width + column] =
+							rhs(rhsInner.first + row, localColumns.first + column);
+
+			std::vector<T> resultBlock(static_cast<std::size_t>(height) * width, T());
+			summa<T>(transport, grid, rows, inner, columns, lhsBlock.data(), rhsBlock.data(), resultBlock.data());
+
+			for(int row = 0; row < height; ++row)
+				for(int column = 0; column < width; ++column)
+					product(localRows.first + row, localColumns.first + column,
+							resultBlock[static_cast<std::size_t>(row) * width + column]);
+		}
+
+		/// Copy rows x columns of m into a row-major buffer
+		template <int M, int N, typename T>
+		std::vector<T> pack(const Matrix<M, N, T>& m, std::pair<int, int> rows, std::pair<int, int> columns) {
+			int width = columns.second - columns.first;
+			std::vector<T> block(static_cast<std::size_t>(rows.second - rows.first) * width);
+			for(int row = rows.first; row < rows.second; ++row) {
+				std::copy(m[row].begin() + columns.first, m[row].begin() + columns.second,
+						block.begin() + static_cast<std::size_t>(row - rows.first) * width);
+			}
+			return block;
+		}
+
+		//
+		// multiply (Transport&, const ProcessGrid&, const Matrix<M, K, T>*, const Matrix<K, N, T>*, Matrix<M, N, T>*) -> void
+		//
+		template <int M, int K, int N, typename T>
+		void multiply(Transport& transport, const ProcessGrid& grid, const Matrix<M, K, T>* lhs,
+				const Matrix<K, N, T>* rhs, Matrix<M, N, T>* result) {
+			const int rank = transport.rank();
+			if(rank == 0 && (!lhs || !rhs || !result))
+				throw std::invalid_argument("rank 0 must provide the operands and the product");
+
+			// Shapes of the blocks held by a rank
+			auto lhsRows = [&grid] (int r) { return partition(M, grid.getRows(), grid.rowOf(r)); };
+			auto lhsColumns = [&grid] (int r) { return partition(K, grid.getColumns(), grid.columnOf(r)); };
+			auto rhsRows = [&grid] (int r) { return partition(K, grid.getRows(), grid.rowOf(r)); };
+			auto rhsColumns = [&grid] (int r) { return partition(N, grid.getColumns(), grid.columnOf(r)); };
+			auto area = [] (std::pair<int, int> rows, std::pair<int, int> columns) {
+				return static_cast<std::size_t>(rows.second - rows.first) * (columns.second - columns.first);
+			};
+
+			// Scatter the operand blocks from rank 0
+			std::vector<T> lhsBlock, rhsBlock;
+			if(rank == 0) {
+				for(int r = 1; r < transport.size(); ++r) {
+					std::vector<T> block = pack(*lhs, lhsRows(r), lhsColumns(r));
+					transport.send(r, block.data(), sizeof(T) * block.size());
+					block = pack(*rhs, rhsRows(r), rhsColumns(r));
+					transport.send(r, block.data(), sizeof(T) * block.size());
+				}
+				lhsBlock = pack(*lhs, lhsRows(0), lhsColumns(0));
+				rhsBlock = pack(*rhs, rhsRows(0), rhsColumns(0));
+			}
+			else {
+				lhsBlock.resize(area(lhsRows(rank), lhsColumns(rank)));
+				transport.receive(0, lhsBlock.data(), sizeof(T) * lhsBlock.size());
+				rhsBlock.resize(area(rhsRows(rank), rhsColumns(rank)));
+				transport.receive(0, rhsBlock.data(), sizeof(T) * rhsBlock.size());
+			}
+
+			std::vector<T> resultBlock(area(lhsRows(rank), rhsColumns(rank)), T());
+			summa<T>(transport, grid, M, K, N, lhsBlock.data(), rhsBlock.data(), resultBlock.data());
+
+			// Gather the product blocks to rank 0
+			if(rank != 0) {
+				transport.send(0, resultBlock.data(), sizeof(T) * resultBlock.size());
+				return;
+			}
+			for(int r = 0; r < transport.size(); ++r) {
+				auto rows = lhsRows(r);
+				auto columns = rhsColumns(r);
+				if(r != 0) {
+					resultBlock.resize(area(rows, columns));
+					transport.receive(r, resultBlock.data(), sizeof(T) * resultBlock.size());
+				}
+
+				int width = columns.second - columns.first;
+				for(int row = rows.first; row < rows.second; ++row) {
+					const T* source = resultBlock.data() + static_cast<std::size_t>(row - rows.first) * width;
+					std::copy(source, source + width, (*result)[row].begin() + columns.first);
+				}
+			}
+		}
+
+		//
+		// multiply (const Matrix<M, K, T>&, const Matrix<K, N, T>&, int) -> Matrix<M, N, T>
+		//
+		template <int M, int K, int N, typename T>
+		Matrix<M, N, T> multiply(const Matrix<M, K, T>& lhs, const Matrix<K, N, T>& rhs, int processes) {
+			Matrix<M, N, T> result;
+			ProcessGrid grid = ProcessGrid::square(processes);
+
+			runLocal(processes, [&] (Transport& transport) {
+				// Forked ranks already hold copies of the operands, but take their
+				// blocks through the transport like any other
+				if(transport.rank() == 0)
+					multiply(transport, grid, &lhs, &rhs, &result);
+				else
+					multiply<M, K, N, T>(transport, grid, nullptr, nullptr, nullptr);
+			});
+
+			return result;
+		}
+	}
+}
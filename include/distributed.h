@@ -0,0 +1,206 @@
+/**
+ *  @file		distributed.h
+ *  @brief	  Define matrix multiplication across several processes with SUMMA
+ *
+ * 	Operands are split into blocks over a 2D grid of processes, each process
+ * 	keeping one block of the left side, right side and product.  The shared
+ * 	dimension is walked in panels, each panel of the left side is broadcast
+ * 	along the grid rows and each panel of the right side along the grid
+ * 	columns, then every process multiplies the panels into its block.
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-19-2026
+ *  @version	0.1
+ */
+
+#ifndef DISTRIBUTED_H
+#define DISTRIBUTED_H
+
+#include <utility>
+#include <vector>
+#include <type_traits>
+#include <stdexcept>
+
+#include "matrix/matrix.h"
+#include "matrix/transport.h"
+
+namespace matrix {
+	namespace distributed {
+
+		/**
+		 * 	@brief	Range [begin, end) of part index when extent is split into parts
+		 *
+		 * 	Parts differ in length by at most one
+		 *
+		 * 	@version	0.1
+		 */
+		inline std::pair<int, int> partition(int extent, int parts, int index) {
+			return {
+				static_cast<int>(static_cast<long>(extent) * index / parts),
+				static_cast<int>(static_cast<long>(extent) * (index + 1) / parts)
+			};
+		}
+
+		/**
+		 * 	@class		ProcessGrid
+		 * 	@brief		Ranks laid out row-major over rows x columns
+		 *
+		 */
+		class ProcessGrid {
+			public:
+				/**
+				 * 	@brief	Grid of rows x columns ranks
+				 *
+				 * 	@throws   std::invalid_argument		If either side is less than 1
+				 *
+				 * 	@version	0.1
+				 */
+				ProcessGrid(int rows, int columns) :
+						rows(rows), columns(columns) {
+					if(rows < 1 || columns < 1)
+						throw std::invalid_argument("a process grid needs at least one row and column");
+				}
+
+				/// The squarest grid of exactly processes ranks, never taller than wide
+				static ProcessGrid square(int processes) {
+					int rows = 1;
+					for(int candidate = 1; candidate * candidate <= processes; ++candidate) {
+						if(processes % candidate == 0)
+							rows = candidate;
+					}
+					return ProcessGrid(rows, processes / rows);
+				}
+
+				// ----- Inline Methods -----
+				/// Get the number of rows of ranks
+				inline int getRows() const { return this->rows; }
+
+				/// Get the number of columns of ranks
+				inline int getColumns() const { return this->columns; }
+
+				/// Get the number of ranks
+				inline int size() const { return this->rows * this->columns; }
+
+				/// Get the grid row of a rank
+				inline int rowOf(int rank) const { return rank / this->columns; }
+
+				/// Get the grid column of a rank
+				inline int columnOf(int rank) const { return rank % this->columns; }
+
+				/// Get the rank at a grid position
+				inline int rankOf(int row, int column) const { return row * this->columns + column; }
+
+				/// Get the ranks of one grid row
+				std::vector<int> rowGroup(int row) const {
+					std::vector<int> group;
+					for(int column = 0; column < this->columns; ++column)
+						group.push_back(this->rankOf(row, column));
+					return group;
+				}
+
+				/// Get the ranks of one grid column
+				std::vector<int> columnGroup(int column) const {
+					std::vector<int> group;
+					for(int row = 0; row < this->rows; ++row)
+						group.push_back(this->rankOf(row, column));
+					return group;
+				}
+
+			private:
+				/// Number of rows of ranks
+				int rows;
+
+				/// Number of columns of ranks
+				int columns;
+		};
+
+		/**
+		 * 	@brief	Accumulate the local block of lhs * rhs on every rank of grid
+		 *
+		 * 	lhs is rows x inner, rhs is inner x columns.  The rank at grid (i, j)
+		 * 	holds, row-major and contiguous:
+		 * 		lhs rows partition(rows, R, i), columns partition(inner, C, j)
+		 * 		rhs rows partition(inner, R, i), columns partition(columns, C, j)
+		 * 		result rows partition(rows, R, i), columns partition(columns, C, j)
+		 * 	where the grid is R x C.  Every rank of grid must call it.
+		 *
+		 * 	@param	Transport&				Connects the ranks of grid
+		 * 	@param	const ProcessGrid&		Layout of the ranks
+		 * 	@param	int						Rows of lhs and result
+		 * 	@param	int						Shared dimension of lhs and rhs
+		 * 	@param	int						Columns of rhs and result
+		 * 	@param	const T*					Local block of lhs
+		 * 	@param	const T*					Local block of rhs
+		 * 	@param	T*							Local block of result, added to
+		 *
+		 * 	@version	0.1
+		 */
+		template <typename T>
+		void summa(Transport& transport, const ProcessGrid& grid, int rows, int inner, int columns,
+				const T* lhs, const T* rhs, T* result);
+
+		/**
+		 * 	@brief	Multiply on every rank of transport, each rank holding only its own blocks
+		 *
+		 * 	Every rank fills its blocks of the operands from lhs(row, column) and
+		 * 	rhs(row, column), then is handed its block of the product through
+		 * 	product(row, column, value), all with indices into the whole matrices.
+		 * 	No rank ever holds more than its blocks, so this is the way to multiply
+		 * 	operands too large for one process.  Every rank of grid must call it.
+		 *
+		 * 	@param	Transport&				Connects the ranks of grid
+		 * 	@param	const ProcessGrid&		Layout of the ranks, its size must match transport
+		 * 	@param	int						Rows of lhs and the product
+		 * 	@param	int						Shared dimension of lhs and rhs
+		 * 	@param	int						Columns of rhs and the product
+		 * 	@param	Lhs						Called as lhs(row, column) -> T
+		 * 	@param	Rhs						Called as rhs(row, column) -> T
+		 * 	@param	Product					Called as product(row, column, value)
+		 *
+		 * 	@version	0.1
+		 */
+		template <typename T, typename Lhs, typename Rhs, typename Product>
+		void multiplyBlocks(Transport& transport, const ProcessGrid& grid, int rows, int inner, int columns,
+				Lhs lhs, Rhs rhs, Product product);
+
+		/**
+		 * 	@brief	Multiply on every rank of transport, scattering from and gathering to rank 0
+		 *
+		 * 	Only rank 0 reads the operands and writes the product, the other ranks
+		 * 	pass nullptr and only ever hold their own blocks.  Rank 0 still holds
+		 * 	both operands and the whole product, see multiplyBlocks() to avoid that.
+		 *
+		 * 	@param	Transport&					Connects the ranks of grid
+		 * 	@param	const ProcessGrid&			Layout of the ranks, its size must match transport
+		 * 	@param	const Matrix<M, K, T>*		Left side, on rank 0
+		 * 	@param	const Matrix<K, N, T>*		Right side, on rank 0
+		 * 	@param	Matrix<M, N, T>*				Product, on rank 0
+		 *
+		 * 	@version	0.1
+		 */
+		template <int M, int K, int N, typename T>
+		void multiply(Transport& transport, const ProcessGrid& grid, const Matrix<M, K, T>* lhs,
+				const Matrix<K, N, T>* rhs, Matrix<M, N, T>* result);
+
+		/**
+		 * 	@brief	Multiply across processes local worker processes
+		 *
+		 * 	Workers are forked with runLocal() on a ProcessGrid::square() grid.
+		 * 	A convenience for operands that fit in this process, every block passes
+		 * 	through it, so multiplyBlocks() is the one that scales.
+		 *
+		 * 	@param	const Matrix<M, K, T>&		Left side
+		 * 	@param	const Matrix<K, N, T>&		Right side
+		 * 	@param	int							Number of processes, this one included
+		 * 	@return	  Matrix<M, N, T>				The product
+		 *
+		 * 	@version	0.1
+		 */
+		template <int M, int K, int N, typename T>
+		Matrix<M, N, T> multiply(const Matrix<M, K, T>& lhs, const Matrix<K, N, T>& rhs, int processes);
+	}
+}
+
+#include "matrix/distributed.cpp"
+
+#endif
@@ -0,0 +1,259 @@
+/**
+ *  @file		graph.cpp
+ *  @brief	  Implement the template code for the computation graph
+ *
+ * 	Details
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-19-2026
+ *  @version	0.1
+ */
+
+#include "graph.h"
+
+namespace matrix {
+	namespace graph {
+		//
+		// InputNode Constructor
+		//
+		template <int M, int N, typename T>
+		InputNode<M, N, T>::InputNode(Matrix<M, N, T> value) :
+				value(std::move(value)) {
+			this->version = 1;
+		}
+
+		//
+		// set (Matrix<M, N, T>) -> void
+		//
+		template <int M, int N, typename T>
+		void InputNode<M, N, T>::set(Matrix<M, N, T> value) {
+			this->value = std::move(value);
+			++this->version;
+		}
+
+		//
+		// modify (Function) -> void
+		//
+		template <int M, int N, typename T>
+		template <typename Function>
+		void InputNode<M, N, T>::modify(Function function) {
+			function(this->value);
+			++this->version;
+		}
+
+		//
+		// OperationNode Constructor
+		//
+		template <int M, int N, typename T, typename Compute, typename... Children>
+		OperationNode<M, N, T, Compute, Children...>::OperationNode(Compute compute,
+				std::shared_ptr<Children>... children) :
+				compute(std::move(compute)),
+				children(std::move(children)...),
+				seen{} {
+
+		}
+
+		//
+		// update (unsigned long) -> const Matrix<M, N, T>&
+		//
+		template <int M, int N, typename T, typename Compute, typename... Children>
+		const Matrix<M, N, T>& OperationNode<M, N, T, Compute, Children...>::update(unsigned long pass) {
+			// Already brought up to date through another path of this pass
+			if(this->pass == pass)
+				return this->value;
+			this->pass = pass;
+			++this->visits;
+
+			return this->update(pass, std::index_sequence_for<Children...>());
+		}
+
+		//
+		// update (unsigned long, std::index_sequence<I...>) -> const Matrix<M, N, T>&
+		//
+		template <int M, int N, typename T, typename Compute, typename... Children>
+		template <std::size_t... I>
+		const Matrix<M, N, T>& OperationNode<M, N, T, Compute, Children...>::update(unsigned long pass,
+				std::index_sequence<I...>) {
+			// Children bring themselves up to date first, only changed ones bump their version
+			std::tuple<decltype(std::get<I>(this->children)->update(pass))...> values(
+					std::get<I>(this->children)->update(pass)...);
+
+			bool dirty = !this->computed;
+			((dirty = dirty || std::get<I>(this->children)->getVersion() != this->seen[I]), ...);
+			if(!dirty)
+				return this->value;
+
+			this->value = this->compute(std::get<I>(values)...);
+			this->seen = {std::get<I>(this->children)->getVersion()...};
+			this->computed = true;
+			++this->version;
+			++this->computations;
+
+			return this->value;
+		}
+
+		//
+		// Input Constructor
+		//
+		template <int M, int N, typename T>
+		Input<M, N, T>::Input(Matrix<M, N, T> value) :
+				Input(std::make_shared<InputNode<M, N, T>>(std::move(value))) {
+
+		}
+
+		//
+		// Input Node Constructor
+		//
+		template <int M, int N, typename T>
+		Input<M, N, T>::Input(std::shared_ptr<InputNode<M, N, T>> input) :
+				Expr<M, N, T>(input),
+				input(std::move(input)) {
+
+		}
+
+		/// Make an Expr over a new OperationNode
+		template <int M, int N, typename T, typename Compute, typename... Children>
+		Expr<M, N, T> makeOperation(Compute compute, const std::shared_ptr<Children>&... children) {
+			return Expr<M, N, T>(std::make_shared<OperationNode<M, N, T, Compute, Children...>>(
+					std::move(compute), children...));
+		}
+
+		//
+		// operator + (const Expr<M, N, T>&, const Expr<M, N, T>&) -> Expr<M, N, T>
+		//
+		template <int M, int N, typename T>
+		Expr<M, N, T> operator + (const Expr<M, N, T>& lhs, const Expr<M, N, T>& rhs) {
+			return makeOperation<M, N, T>([] (const Matrix<M, N, T>& left, const Matrix<M, N, T>& right) {
+				Matrix<M, N, T> result(left);
+				result += right;
+				return result;
+			}, lhs.getNode(), rhs.getNode());
+		}
+
+		//
+		// operator - (const Expr<M, N, T>&, const Expr<M, N, T>&) -> Expr<M, N, T>
+		//
+		template <int M, int N, typename T>
+		Expr<M, N, T> operator - (const Expr<M, N, T>& lhs, const Expr<M, N, T>& rhs) {
+			return makeOperation<M, N, T>([] (const Matrix<M, N, T>& left, const Matrix<M, N, T>& right) {
+				Matrix<M, N, T> result(left);
+				result -= right;
+				return result;
+			}, lhs.getNode(), rhs.getNode());
+		}
+
+		//
+		// operator * (const Expr<M, N, T>&, const T&) -> Expr<M, N, T>
+		//
+		template <int M, int N, typename T>
+		Expr<M, N, T> operator * (const Expr<M, N, T>& lhs, const T& scalar) {
+			return makeOperation<M, N, T>([scalar] (const Matrix<M, N, T>& left) {
+				Matrix<M, N, T> result(left);
+				result *= scalar;
+				return result;
+			}, lhs.getNode());
+		}
+
+		//
+		// operator * (const Expr<M, K, T>&, const Expr<K, N, T>&) -> Expr<M, N, T>
+		//
+		template <int M, int K, int N, typename T>
+		Expr<M, N, T> operator * (const Expr<M, K, T>& lhs, const Expr<K, N, T>& rhs) {
+			return makeOperation<M, N, T>([] (const Matrix<M, K, T>& left, const Matrix<K, N, T>& right) {
+				return left * right;
+			}, lhs.getNode(), rhs.getNode());
+		}
+
+		//
+		// transpose (const Expr<M, N, T>&) -> Expr<N, M, T>
+		//
+		template <int M, int N, typename T>
+		Expr<N, M, T> transpose(const Expr<M, N, T>& m) {
+			return makeOperation<N, M, T>([] (const Matrix<M, N, T>& value) {
+				return value.transpose();
+			}, m.getNode());
+		}
+
+		//
+		// chainOrder (const std::array<long, COUNT + 1>&) -> ChainOrder<COUNT>
+		//
+		template <std::size_t COUNT>
+		constexpr ChainOrder<COUNT> chainOrder(const std::array<long, COUNT + 1>& dimensions) {
+			ChainOrder<COUNT> order;
+
+			// Solve every run of matrices, shortest first
+			for(std::size_t length = 2; length <= COUNT; ++length) {
+				for(std::size_t i = 0; i + length <= COUNT; ++i) {
+					std::size_t j = i + length - 1;
+					order.cost[i][j] = -1;
+					for(std::size_t k = i; k < j; ++k) {
+						long cost = order.cost[i][k] + order.cost[k + 1][j]
+								+ dimensions[i] * dimensions[k + 1] * dimensions[j + 1];
+						if(order.cost[i][j] < 0 || cost < order.cost[i][j]) {
+							order.cost[i][j] = cost;
+							order.split[i][j] = k;
+						}
+					}
+				}
+			}
+
+			return order;
+		}
+
+		/**
+		 * 	@struct		ChainBuilder
+		 * 	@brief		Builds the product tree chosen by chainOrder() for Exprs
+		 *
+		 */
+		template <typename... Exprs>
+		struct ChainBuilder {
+			static constexpr std::size_t COUNT = sizeof...(Exprs);
+
+			/// Columns of the last expression
+			static constexpr long LAST = std::tuple_element_t<COUNT - 1, std::tuple<Exprs...>>::COLUMNS;
+
+			/// Rows of each expression, then the columns of the last
+			static constexpr std::array<long, COUNT + 1> DIMENSIONS = {Exprs::ROWS..., LAST};
+
+			static constexpr ChainOrder<COUNT> ORDER = chainOrder<COUNT>(DIMENSIONS);
+
+			/// If the columns of each expression match the rows of the next
+			static constexpr bool chainable() {
+				std::array<long, COUNT> rows = {Exprs::ROWS...};
+				std::array<long, COUNT> columns = {Exprs::COLUMNS...};
+				for(std::size_t i = 0; i + 1 < COUNT; ++i) {
+					if(columns[i] != rows[i + 1])
+						return false;
+				}
+				return true;
+			}
+
+			/// Product of expressions I through J
+			template <std::size_t I, std::size_t J>
+			static auto build(const std::tuple<const Exprs&...>& exprs) {
+				if constexpr(I == J)
+					return std::get<I>(exprs);
+				else {
+					constexpr std::size_t K = ORDER.split[I][J];
+					return build<I, K>(exprs) * build<K + 1, J>(exprs);
+				}
+			}
+		};
+
+		//
+		// chain (const First&, const Rest&...) -> Expr
+		//
+		template <typename First, typename... Rest>
+		auto chain(const First& first, const Rest&... rest) {
+			using Builder = ChainBuilder<Expr<First::ROWS, First::COLUMNS, typename First::Value>,
+					Expr<Rest::ROWS, Rest::COLUMNS, typename Rest::Value>...>;
+
+			static_assert(Builder::chainable(),
+					"chain requires the columns of each expression to match the rows of the next");
+
+			return Builder::template build<0, sizeof...(Rest)>(std::forward_as_tuple(
+					static_cast<const Expr<First::ROWS, First::COLUMNS, typename First::Value>&>(first),
+					static_cast<const Expr<Rest::ROWS, Rest::COLUMNS, typename Rest::Value>&>(rest)...));
+		}
+	}
+}
@@ -0,0 +1,278 @@
+/**
+ *  @file		graph.h
+ *  @brief	  Define a lazy, memoizing computation graph over Matrix operations
+ *
+ * 	Expressions built from Inputs with the usual operators only record the
+ * 	operation.  Evaluating an expression computes each node once and caches
+ * 	the result; after an Input changes, only the nodes that depend on it are
+ * 	recomputed.  chain() multiplies several expressions in the cheapest
+ * 	order, chosen at compile time from their dimensions.
+ *
+ * 	Graphs are not thread safe, evaluate a graph from one thread at a time.
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-19-2026
+ *  @version	0.1
+ */
+
+#ifndef GRAPH_H
+#define GRAPH_H
+
+#include <memory>
+#include <atomic>
+#include <tuple>
+#include <array>
+#include <utility>
+#include <type_traits>
+
+#include "matrix/matrix.h"
+
+namespace matrix {
+	namespace graph {
+
+		/// Start a new evaluation pass, numbered uniquely across every graph
+		inline unsigned long nextPass() {
+			static std::atomic<unsigned long> passes(0);
+			return ++passes;
+		}
+
+		/**
+		 * 	@class		Node
+		 * 	@brief		Vertex of the graph producing an M x N matrix
+		 *
+		 */
+		template <int M, int N, typename T>
+		class Node {
+			public:
+				virtual ~Node() = default;
+
+				/**
+				 * 	@brief	Bring the value up to date and return it
+				 *
+				 * 	The reference stays valid until the node is evaluated again
+				 *
+				 * 	@version	0.2
+				 */
+				inline const Matrix<M, N, T>& evaluate() { return this->update(nextPass()); }
+
+				/**
+				 * 	@brief	Bring the value up to date within an evaluation pass
+				 *
+				 * 	A node reached again in the same pass, through a shared subexpression,
+				 * 	returns its value without visiting its children again
+				 *
+				 * 	@param	unsigned long			Pass from nextPass()
+				 * 	@return	  const Matrix<M, N, T>&	Current value
+				 *
+				 * 	@version	0.1
+				 */
+				virtual const Matrix<M, N, T>& update(unsigned long pass) = 0;
+
+				// ----- Inline Methods -----
+				/// Get the version of the value, it changes whenever the value does
+				inline unsigned long getVersion() const { return this->version; }
+
+				/// Get the number of times the value has been computed
+				inline unsigned long getComputations() const { return this->computations; }
+
+				/// Get the number of passes that have visited the node's children
+				inline unsigned long getVisits() const { return this->visits; }
+
+			protected:
+				/// Version of the value
+				unsigned long version = 0;
+
+				/// Number of times the value has been computed
+				unsigned long computations = 0;
+
+				/// Number of passes that have visited the node's children
+				unsigned long visits = 0;
+		};
+
+		/**
+		 * 	@class		InputNode
+		 * 	@brief		Node holding a matrix set from outside the graph
+		 *
+		 */
+		template <int M, int N, typename T>
+		class InputNode : public Node<M, N, T> {
+			public:
+				/// Hold value, starting at version 1
+				explicit InputNode(Matrix<M, N, T> value);
+
+				const Matrix<M, N, T>& update(unsigned long) override { return this->value; }
+
+				/// Replace the value, marking every dependent node dirty
+				void set(Matrix<M, N, T> value);
+
+				/// Change the value in place with function(Matrix<M, N, T>&), marking dependents dirty
+				template <typename Function>
+				void modify(Function function);
+
+			private:
+				/// Current value
+				Matrix<M, N, T> value;
+		};
+
+		/**
+		 * 	@class		OperationNode
+		 * 	@brief		Node computing compute(children...), cached until a child changes
+		 *
+		 */
+		template <int M, int N, typename T, typename Compute, typename... Children>
+		class OperationNode : public Node<M, N, T> {
+			public:
+				OperationNode(Compute compute, std::shared_ptr<Children>... children);
+
+				/// Update the children, recomputing only if one of them changed
+				const Matrix<M, N, T>& update(unsigned long pass) override;
+
+			private:
+				template <std::size_t... I>
+				const Matrix<M, N, T>& update(unsigned long pass, std::index_sequence<I...>);
+
+				/// Produces the value from the children's values
+				Compute compute;
+
+				/// Operands
+				std::tuple<std::shared_ptr<Children>...> children;
+
+				/// Version of each child the value was computed from
+				std::array<unsigned long, sizeof...(Children)> seen;
+
+				/// If value has been computed at all
+				bool computed = false;
+
+				/// Last pass that visited the node
+				unsigned long pass = 0;
+
+				/// Cached value
+				Matrix<M, N, T> value;
+		};
+
+		/**
+		 * 	@class		Expr
+		 * 	@brief		Handle to a node, combined with the usual operators
+		 *
+		 * 	Copies of an Expr refer to the same node, so shared subexpressions
+		 * 	are computed once
+		 *
+		 */
+		template <int M, int N, typename T = double>
+		class Expr {
+			public:
+				/// Rows of the value
+				static constexpr int ROWS = M;
+
+				/// Columns of the value
+				static constexpr int COLUMNS = N;
+
+				/// Type of the value
+				using Value = T;
+
+				/// Refer to node
+				explicit Expr(std::shared_ptr<Node<M, N, T>> node) :
+						node(std::move(node)) { }
+
+				// ----- Inline Methods -----
+				/// Bring the value up to date and return it
+				inline const Matrix<M, N, T>& evaluate() const { return this->node->evaluate(); }
+
+				/// Get the node referred to
+				inline const std::shared_ptr<Node<M, N, T>>& getNode() const { return this->node; }
+
+			private:
+				/// Node referred to
+				std::shared_ptr<Node<M, N, T>> node;
+		};
+
+		/**
+		 * 	@class		Input
+		 * 	@brief		Expr whose value is set from outside the graph
+		 *
+		 */
+		template <int M, int N, typename T = double>
+		class Input : public Expr<M, N, T> {
+			public:
+				/// New input holding value
+				explicit Input(Matrix<M, N, T> value = Matrix<M, N, T>());
+
+				// ----- Inline Methods -----
+				/// Get the current value
+				inline const Matrix<M, N, T>& get() const { return this->input->evaluate(); }
+
+				/// Replace the value, marking every dependent node dirty
+				inline void set(Matrix<M, N, T> value) { this->input->set(std::move(value)); }
+
+				/// Change the value in place with function(Matrix<M, N, T>&), marking dependents dirty
+				template <typename Function>
+				inline void modify(Function function) { this->input->modify(std::move(function)); }
+
+			private:
+				/// The node, typed so it can be set
+				std::shared_ptr<InputNode<M, N, T>> input;
+
+				Input(std::shared_ptr<InputNode<M, N, T>> input);
+		};
+
+		/// Lazy lhs + rhs
+		template <int M, int N, typename T>
+		Expr<M, N, T> operator + (const Expr<M, N, T>& lhs, const Expr<M, N, T>& rhs);
+
+		/// Lazy lhs - rhs
+		template <int M, int N, typename T>
+		Expr<M, N, T> operator - (const Expr<M, N, T>& lhs, const Expr<M, N, T>& rhs);
+
+		/// Lazy lhs * scalar
+		template <int M, int N, typename T>
+		Expr<M, N, T> operator * (const Expr<M, N, T>& lhs, const T& scalar);
+
+		/// Lazy lhs * rhs
+		template <int M, int K, int N, typename T>
+		Expr<M, N, T> operator * (const Expr<M, K, T>& lhs, const Expr<K, N, T>& rhs);
+
+		/// Lazy transpose of m
+		template <int M, int N, typename T>
+		Expr<N, M, T> transpose(const Expr<M, N, T>& m);
+
+		/**
+		 * 	@brief	Cheapest order to multiply a chain of COUNT matrices
+		 *
+		 * 	Matrix i is dimensions[i] x dimensions[i + 1].  cost[i][j] is the
+		 * 	fewest scalar multiplications for matrices i through j, and split[i][j]
+		 * 	the k for which (i..k)(k+1..j) reaches it.
+		 *
+		 */
+		template <std::size_t COUNT>
+		struct ChainOrder {
+			std::array<std::array<long, COUNT>, COUNT> cost {};
+			std::array<std::array<std::size_t, COUNT>, COUNT> split {};
+		};
+
+		/**
+		 * 	@brief	Solve the matrix chain ordering problem by dynamic programming
+		 *
+		 * 	@param	const std::array<long, COUNT + 1>&		Dimensions of the chain
+		 * 	@return	  ChainOrder<COUNT>						Costs and splits
+		 *
+		 * 	@version	0.1
+		 */
+		template <std::size_t COUNT>
+		constexpr ChainOrder<COUNT> chainOrder(const std::array<long, COUNT + 1>& dimensions);
+
+		/**
+		 * 	@brief	Lazy product of expressions, associated to need the fewest multiplications
+		 *
+		 * 	chain(A, B, C) equals A * B * C, but builds (A * B) * C or A * (B * C)
+		 * 	depending on which is cheaper for the dimensions of A, B and C
+		 *
+		 * 	@version	0.1
+		 */
+		template <typename First, typename... Rest>
+		auto chain(const First& first, const Rest&... rest);
+	}
+}
+
+#include "matrix/graph.cpp"
+
+#endif
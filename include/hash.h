@@ -0,0 +1,82 @@
+/**
+ *  @file		hash.h
+ *  @brief	  Define a fast content hash for matrices
+ *
+ * 	hash() feeds the rows of a Matrix through the XXH64 ContentHasher, so
+ * 	equal matrices hash equal without comparing them.
+ * 	std::hash is specialized so a Matrix can key an unordered container.
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-19-2026
+ *  @version	0.1
+ */
+
+#ifndef HASH_H
+#define HASH_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cmath>
+#include <limits>
+#include <functional>
+#include <type_traits>
+
+#include "matrix/matrix.h"
+#include "matrix/content_hasher.h"
+
+namespace matrix {
+
+	/**
+	 * 	@brief	Hash the values of a matrix
+	 *
+	 * 	T must be integral, an enum, a pointer, or floating point, where
+	 * 	-0 is hashed as +0 and every NaN alike so that equal values hash equal
+	 *
+	 * 	@param	const Matrix<M, N, T>&		Matrix to hash
+	 * 	@param	std::uint64_t				Seed
+	 * 	@return	  std::uint64_t				Hash of the values
+	 *
+	 * 	@version	0.1
+	 */
+	template <int M, int N, typename T>
+	std::uint64_t hash(const Matrix<M, N, T>& m, std::uint64_t seed = 0) {
+		// Class types may define == other than by bytes, so only hash types where it is
+		static_assert(std::is_integral_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>
+				|| std::is_floating_point_v<T>, "hash requires integral, enum, pointer or floating point T");
+
+		ContentHasher hasher(seed);
+		for(int row = 0; row < M; ++row) {
+			const T* values = m[row].data();
+			if constexpr(std::is_floating_point<T>::value) {
+				// Canonicalize a chunk at a time, adding 0 turns -0 into +0
+				constexpr int CHUNK = 64;
+				T chunk[CHUNK];
+				for(int column = 0; column < N; column += CHUNK) {
+					int count = std::min(CHUNK, N - column);
+					for(int i = 0; i < count; ++i) {
+						T value = values[column + i];
+						chunk[i] = std::isnan(value) ? std::numeric_limits<T>::quiet_NaN() : value + T(0);
+					}
+					hasher.update(chunk, sizeof(T) * count);
+				}
+			}
+			else
+				hasher.update(values, sizeof(T) * N);
+		}
+
+		return hasher.digest();
+	}
+}
+
+namespace std {
+	/// Hash a Matrix by its values, see matrix::hash()
+	template <int M, int N, typename T>
+	struct hash<matrix::Matrix<M, N, T>> {
+		std::size_t operator () (const matrix::Matrix<M, N, T>& m) const {
+			return static_cast<std::size_t>(matrix::hash(m));
+		}
+	};
+}
+
+#endif
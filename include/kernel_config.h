@@ -0,0 +1,137 @@
+/**
+ *  @file		kernel_config.h
+ *  @brief	  Define the tunable parameters of the matrix kernels
+ *
+ * 	Block sizes and threading cutoffs are best chosen per machine.  The
+ * 	values are loaded once from the file written by the matrix_tune tool,
+ * 	falling back to the compiled defaults when there is no such file.
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-19-2026
+ *  @version	0.1
+ */
+
+#ifndef KERNEL_CONFIG_H
+#define KERNEL_CONFIG_H
+
+#include <string>
+#include <atomic>
+
+namespace matrix {
+
+	/**
+	 * 	@class		KernelConfig
+	 * 	@brief		Parameters shared by the blocked and parallel kernels
+	 *
+	 * 	The file is plain key=value lines, '#' starts a comment.
+	 * 	getInstance() reads the file named by the MATRIX_KERNEL_CONFIG
+	 * 	environment variable, or matrix_kernels.conf in the working directory.
+	 *
+	 */
+	class KernelConfig {
+		public:
+			/// Compiled default for the edge of a GEMM cache block
+			static constexpr int DEFAULT_GEMM_BLOCK_SIZE = 64;
+
+			/// Compiled default for the edge of a transpose cache block
+			static constexpr int DEFAULT_TRANSPOSE_BLOCK_SIZE = 32;
+
+			/// Compiled default for the fewest multiply-adds of a product worth threading
+			static constexpr long DEFAULT_GEMM_THRESHOLD = 1L << 16;
+
+			/// Compiled default for the fewest elements of elementwise work worth threading
+			static constexpr long DEFAULT_ELEMENTWISE_THRESHOLD = 1L << 16;
+
+			/// Name of the file read when the environment doesn't name one
+			static constexpr const char* DEFAULT_PATH = "matrix_kernels.conf";
+
+			/**
+			 * 	@brief	Default Constructor
+			 *
+			 * 	Starts with the compiled defaults
+			 *
+			 * 	@version	0.1
+			 */
+			KernelConfig();
+
+			KernelConfig(const KernelConfig& copy) = delete;
+			KernelConfig& operator = (const KernelConfig& rhs) = delete;
+
+			/// Get the configuration used by the kernels, loading it on first use
+			static KernelConfig& getInstance();
+
+			/// Get the path getInstance() loads from
+			static std::string getDefaultPath();
+
+			/**
+			 * 	@brief	Load values from a configuration file
+			 *
+			 * 	Values that are missing or invalid keep their current setting
+			 *
+			 * 	@param	const std::string&		Path to the file
+			 * 	@return	  bool							If the file could be read
+			 *
+			 * 	@version	0.1
+			 */
+			bool load(const std::string& path);
+
+			/**
+			 * 	@brief	Write the current values to a configuration file
+			 *
+			 * 	@param	const std::string&		Path to the file
+			 * 	@return	  bool							If the file could be written
+			 *
+			 * 	@version	0.1
+			 */
+			bool save(const std::string& path) const;
+
+			/// Restore the compiled defaults
+			void reset();
+
+			// ----- Inline Methods -----
+			/// Get the edge of a GEMM cache block
+			inline int getGemmBlockSize() const { return this->gemmBlockSize; }
+
+			/// Set the edge of a GEMM cache block
+			inline void setGemmBlockSize(int size) { this->gemmBlockSize = size; }
+
+			/// Get the edge of a transpose cache block
+			inline int getTransposeBlockSize() const { return this->transposeBlockSize; }
+
+			/// Set the edge of a transpose cache block
+			inline void setTransposeBlockSize(int size) { this->transposeBlockSize = size; }
+
+			/// Get the fewest multiply-adds (rows * inner * columns) of a product worth threading
+			inline long getGemmThreshold() const { return this->gemmThreshold; }
+
+			/// Set the fewest multiply-adds of a product worth threading
+			inline void setGemmThreshold(long threshold) { this->gemmThreshold = threshold; }
+
+			/// Get the fewest elements (rows * columns) of elementwise work worth threading
+			inline long getElementwiseThreshold() const { return this->elementwiseThreshold; }
+
+			/// Set the fewest elements of elementwise work worth threading
+			inline void setElementwiseThreshold(long threshold) { this->elementwiseThreshold = threshold; }
+
+			/// Set both thresholds, 1 threads everything and LONG_MAX nothing
+			inline void setParallelThreshold(long threshold) {
+				this->gemmThreshold = threshold;
+				this->elementwiseThreshold = threshold;
+			}
+
+		private:
+			/// Edge of a GEMM cache block
+			std::atomic<int> gemmBlockSize;
+
+			/// Edge of a transpose cache block
+			std::atomic<int> transposeBlockSize;
+
+			/// Fewest multiply-adds of a product worth threading
+			std::atomic<long> gemmThreshold;
+
+			/// Fewest elements of elementwise work worth threading
+			std::atomic<long> elementwiseThreshold;
+	};
+}
+
+#endif
@@ -0,0 +1,258 @@
+/**
+ *  @file		kernels.h
+ *  @brief	  Define the blocked, multithreaded kernels behind the matrix operators
+ *
+ * 	Kernels work on arrays of row pointers, so they serve the rows of a
+ * 	Matrix as well as any other row-major buffer.  Block sizes and the
+ * 	threading cutoff come from KernelConfig.
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-19-2026
+ *  @version	0.1
+ */
+
+#ifndef KERNELS_H
+#define KERNELS_H
+
+#include <algorithm>
+#include <atomic>
+
+#include "matrix/kernel_config.h"
+#include "matrix/thread_pool.h"
+
+namespace matrix {
+	namespace kernels {
+
+		/**
+		 * 	@brief	Accumulate rows [rowBegin, rowEnd) of lhs * rhs into result
+		 *
+		 * 	Cache-blocked in all three dimensions, the innermost loop runs along
+		 * 	a row of rhs and result so it is contiguous and vectorizable
+		 *
+		 * 	@param	const T* const*		Rows of lhs (rows x inner)
+		 * 	@param	const T* const*		Rows of rhs (inner x columns)
+		 * 	@param	T* const*				Rows of result (rows x columns), added to
+		 * 	@param	int						First row of result to compute
+		 * 	@param	int						One past the last row of result to compute
+		 * 	@param	int						Shared dimension of lhs and rhs
+		 * 	@param	int						Number of columns of rhs and result
+		 * 	@param	int						Edge of a cache block
+		 *
+		 * 	@version	0.1
+		 */
+		template <typename T>
+		void gemm(const T* const* lhs, const T* const* rhs, T* const* result,
+				int rowBegin, int rowEnd, int inner, int columns, int block) {
+			block = std::max(block, 1);
+
+			for(int rowBlock = rowBegin; rowBlock < rowEnd; rowBlock += block) {
+				int rowLimit = std::min(rowBlock + block, rowEnd);
+				for(int innerBlock = 0; innerBlock < inner; innerBlock += block) {
+					int innerLimit = std::min(innerBlock + block, inner);
+					for(int columnBlock = 0; columnBlock < columns; columnBlock += block) {
+						int columnLimit = std::min(columnBlock + block, columns);
+
+						for(int row = rowBlock; row < rowLimit; ++row) {
+							const T* left = lhs[row];
+							T* out = result[row];
+							for(int k = innerBlock; k < innerLimit; ++k) {
+								const T scalar = left[k];
+								const T* right = rhs[k];
+								for(int column = columnBlock; column < columnLimit; ++column)
+									out[column] += scalar * right[column];
+							}
+						}
+					}
+				}
+			}
+		}
+
+		/**
+		 * 	@brief	Accumulate lhs * rhs into result, giving up once stop() returns true
+		 *
+		 * 	stop() is called from the workers before each band of block rows, so
+		 * 	a long product can be abandoned part way, leaving result partly summed
+		 *
+		 * 	@return	  bool		If every row was computed
+		 *
+		 * 	@version	0.1
+		 */
+		template <typename T, typename Stop>
+		bool parallelGemm(const T* const* lhs, const T* const* rhs, T* const* result,
+				int rows, int inner, int columns, Stop stop) {
+			const KernelConfig& config = KernelConfig::getInstance();
+			int block = std::max(config.getGemmBlockSize(), 1);
+
+			std::atomic<bool> stopped(false);
+			auto run = [&] (int begin, int end) {
+				for(int band = begin; band < end; band += block) {
+					if(stopped.load(std::memory_order_relaxed) || stop()) {
+						stopped = true;
+						return;
+					}
+					gemm(lhs, rhs, result, band, std::min(band + block, end), inner, columns, block);
+				}
+			};
+
+			if(static_cast<long>(rows) * inner * columns < config.getGemmThreshold())
+				run(0, rows);
+			else
+				ThreadPool::getInstance().parallelFor(0, rows, run);
+			return !stopped;
+		}
+
+		/**
+		 * 	@brief	Accumulate lhs * rhs into result, across the ThreadPool when large enough
+		 *
+		 * 	Rows of result are split between the workers
+		 *
+		 * 	@version	0.1
+		 */
+		template <typename T>
+		void parallelGemm(const T* const* lhs, const T* const* rhs, T* const* result,
+				int rows, int inner, int columns) {
+			parallelGemm(lhs, rhs, result, rows, inner, columns, [] () { return false; });
+		}
+
+		/**
+		 * 	@brief	Write the transpose of source (rows x columns) into result (columns x rows)
+		 *
+		 * 	Cache-blocked so neither side is walked with a long stride
+		 *
+		 * 	@version	0.1
+		 */
+		template <typename T>
+		void transpose(const T* const* source, T* const* result, int rows, int columns, int block) {
+			block = std::max(block, 1);
+
+			for(int rowBlock = 0; rowBlock < rows; rowBlock += block) {
+				int rowLimit = std::min(rowBlock + block, rows);
+				for(int columnBlock = 0; columnBlock < columns; columnBlock += block) {
+					int columnLimit = std::min(columnBlock + block, columns);
+
+					for(int row = rowBlock; row < rowLimit; ++row) {
+						const T* in = source[row];
+						for(int column = columnBlock; column < columnLimit; ++column)
+							result[column][row] = in[column];
+					}
+				}
+			}
+		}
+
+		/**
+		 * 	@brief	Split rows into fixed blocks and call function(block, rowBegin, rowEnd) for each
+		 *
+		 * 	The split only depends on the shape, never on the number of workers, so
+		 * 	partial results combined in block order are the same on every machine
+		 * 	Blocks run across the ThreadPool when rows * columns is large enough
+		 *
+		 * 	@return	  int		Number of blocks
+		 *
+		 * 	@version	0.1
+		 */
+		template <typename Function>
+		int forRowBlocks(int rows, int columns, Function function) {
+			// Aim for blocks of about 16k elements
+			int rowsPerBlock = std::max(1, (1 << 14) / std::max(columns, 1));
+			int blocks = (rows + rowsPerBlock - 1) / rowsPerBlock;
+
+			auto run = [&] (int begin, int end) {
+				for(int block = begin; block < end; ++block)
+					function(block, block * rowsPerBlock, std::min(rows, (block + 1) * rowsPerBlock));
+			};
+			if(static_cast<long>(rows) * columns < KernelConfig::getInstance().getElementwiseThreshold())
+				run(0, blocks);
+			else
+				ThreadPool::getInstance().parallelFor(0, blocks, run);
+
+			return blocks;
+		}
+
+		/**
+		 * 	@brief	Fold map(value) of count values together with reduce
+		 *
+		 * 	Keeps several independent accumulators so the loop vectorizes,
+		 * 	which requires reduce to be associative and commutative, and identity
+		 * 	to be its identity element
+		 *
+		 * 	@version	0.1
+		 */
+		template <typename U, typename T, typename Map, typename Reduce>
+		inline U reduceRow(const T* values, int count, const U& identity, Map& map, Reduce& reduce) {
+			constexpr int LANES = 8;
+			U lanes[LANES];
+			std::fill(lanes, lanes + LANES, identity);
+
+			int i = 0;
+			for(; i + LANES <= count; i += LANES) {
+				for(int lane = 0; lane < LANES; ++lane)
+					lanes[lane] = reduce(lanes[lane], map(values[i + lane]));
+			}
+
+			U result = identity;
+			for(int lane = 0; lane < LANES; ++lane)
+				result = reduce(result, lanes[lane]);
+			for(; i < count; ++i)
+				result = reduce(result, map(values[i]));
+
+			return result;
+		}
+
+		/**
+		 * 	@brief	Run function(rowBegin, rowEnd) over rows, across the ThreadPool when large enough
+		 *
+		 * 	Used by the elementwise operations, work is measured as rows * columns.
+		 * 	Other kernels pass the work of one row as columns, hence its width.
+		 *
+		 * 	@version	0.2
+		 */
+		template <typename Function>
+		void forRows(int rows, long long columns, Function function) {
+			if(rows * columns < KernelConfig::getInstance().getElementwiseThreshold()) {
+				function(0, rows);
+				return;
+			}
+
+			ThreadPool::getInstance().parallelFor(0, rows, function);
+		}
+
+		/**
+		 * 	@brief	Run function(columnBegin, columnEnd) over strips of columns, across the ThreadPool when large enough
+		 *
+		 * 	For work that folds down whole columns, work is measured as rows * columns.
+		 * 	Strips are at least 16 columns wide, so neighbours rarely share a cache line.
+		 *
+		 * 	@version	0.1
+		 */
+		template <typename Function>
+		void forColumns(int rows, int columns, Function function) {
+			if(static_cast<long>(rows) * columns < KernelConfig::getInstance().getElementwiseThreshold()) {
+				function(0, columns);
+				return;
+			}
+
+			ThreadPool::getInstance().parallelFor(0, columns, function, 16);
+		}
+	}
+}
+
+/**
+ * 	Element types whose kernels are compiled once into the library by
+ * 	src/matrix_instantiations.cpp, see MATRIX_EXPLICIT_INSTANTIATIONS
+ */
+#define MATRIX_KERNEL_TYPES(X) X(int) X(float) X(double)
+
+#ifndef MATRIX_NO_EXTERN_TEMPLATES
+namespace matrix {
+	namespace kernels {
+#define MATRIX_EXTERN_KERNELS(T) \
+		extern template void gemm<T>(const T* const*, const T* const*, T* const*, int, int, int, int, int); \
+		extern template void parallelGemm<T>(const T* const*, const T* const*, T* const*, int, int, int); \
+		extern template void transpose<T>(const T* const*, T* const*, int, int, int);
+		MATRIX_KERNEL_TYPES(MATRIX_EXTERN_KERNELS)
+#undef MATRIX_EXTERN_KERNELS
+	}
+}
+#endif
+
+#endif
@@ -10,6 +10,7 @@
  */
 
 #include <algorithm>
+#include <cstring>
 #include <type_traits>
 
 #include "matrix.h"
@@ -20,13 +21,14 @@ namespace matrix {
 	//
 	template <int M, int N, typename T>
 	Matrix<M, N, T>::Matrix() : 
-			matrix(std::vector<std::vector<T>>()),
+			matrix(M),
 			JSONAble() {
-		// Resize the number of rows to M, then resize each column to N
-		for(int i = 0; i < M; ++i) {
-			// Add a row and fill it with default
-			this->matrix.push_back(std::vector<T>(N));
-		}
+		// Allocate and fill each row with default on the worker that will compute on it,
+		// so large matrices are first touched on the right NUMA node
+		kernels::forRows(M, N, [this] (int begin, int end) {
+			for(int i = begin; i < end; ++i)
+				this->matrix[i] = std::vector<T>(N);
+		});
 	}
 
 	//
@@ -44,9 +46,13 @@ namespace matrix {
 	//
 	template<int M, int N, typename T>
 	Matrix<M, N, T>::Matrix(const Matrix<M, N, T>& copy) : 
-			matrix(copy.matrix),
+			matrix(M),
 			JSONAble(copy) {
-
+		// Copy the rows with the same placement as the default constructor
+		kernels::forRows(M, N, [this, &copy] (int begin, int end) {
+			for(int i = begin; i < end; ++i)
+				this->matrix[i] = copy.matrix[i];
+		});
 	}
 
 	//
@@ -59,6 +65,36 @@ namespace matrix {
 
 	}
 
+	//
+	// Copy Assignment
+	//
+	template<int M, int N, typename T>
+	Matrix<M, N, T>& Matrix<M, N, T>::operator = (const Matrix<M, N, T>& rhs) {
+		if(this == &rhs)
+			return *this;
+
+		// A moved-from matrix has no rows to copy into
+		if(this->matrix.size() != static_cast<std::size_t>(M)) {
+			this->matrix = rhs.matrix;
+			return *this;
+		}
+
+		kernels::forRows(M, N, [this, &rhs] (int begin, int end) {
+			for(int i = begin; i < end; ++i)
+				std::copy(rhs.matrix[i].begin(), rhs.matrix[i].end(), this->matrix[i].begin());
+		});
+		return *this;
+	}
+
+	//
+	// Move Assignment
+	//
+	template<int M, int N, typename T>
+	Matrix<M, N, T>& Matrix<M, N, T>::operator = (Matrix<M, N, T>&& rhs) {
+		this->matrix = std::move(rhs.matrix);
+		return *this;
+	}
+
 	//
 	// JSON Constructor
 	//
@@ -98,12 +134,35 @@ namespace matrix {
 		if(this == &rhs)
 			return true;
 
-		// Move over the matrix and check for any inequalities
+		// Compare row by row: bytes for integers, enums and pointers, where equal
+		// values always have equal bytes, fixed chunks without early exits (so they
+		// vectorize) for floating point, and T's operator== for everything else,
+		// which may not compare by bytes even when T is trivially copyable
+		constexpr int CHUNK = 16;
+		constexpr bool BYTES = std::is_integral_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>;
 		for(int row = 0; row < M; ++row) {
-			for(int col = 0; col < N; ++col) {
-				if(this->matrix[row][col] != rhs.matrix[row][col])
+			const T* left = this->matrix[row].data();
+			const T* right = rhs.matrix[row].data();
+			if constexpr(BYTES) {
+				if(std::memcmp(left, right, sizeof(T) * N) != 0)
 					return false;
 			}
+			else if constexpr(std::is_floating_point<T>::value) {
+				int column = 0;
+				for(; column + CHUNK <= N; column += CHUNK) {
+					bool same = true;
+					for(int i = 0; i < CHUNK; ++i)
+						same &= left[column + i] == right[column + i];
+					if(!same)
+						return false;
+				}
+				for(; column < N; ++column) {
+					if(left[column] != right[column])
+						return false;
+				}
+			}
+			else if(!std::equal(left, left + N, right))
+				return false;
 		}
 
 		// If we get through the array, return true
@@ -193,25 +252,18 @@ namespace matrix {
 	Matrix<M, R, T> Matrix<M, N, T>::operator * (const Matrix<N, R, T>& rhs) const {
 		Matrix<M, R, T> result;
 
-		// Move over the rows of the lhs (this->matrix)
-		for(int rowIndex = 0; rowIndex < M; ++rowIndex) {
-			std::vector<T> resultRow(N);
-			const auto& leftRow = (*this)[rowIndex];
-
-			// Move over the columns over the rhs matrix
-			for(int columnIndex = 0; columnIndex < R; ++columnIndex) {
-				const auto& rightColumn = rhs.getColumn(columnIndex);
-				
-				// Value of the linear combination of leftRow and rightColumn
-				T value = T();
-				for(int i = 0; i < R; ++i) 
-					value += leftRow[i] * rightColumn[i];
-				
-				resultRow[columnIndex] = std::move(value);
-			}
-
-			result[rowIndex] = std::move(resultRow);
+		// Gather the rows of each operand for the kernel
+		std::vector<const T*> leftRows(M), rightRows(N);
+		std::vector<T*> resultRows(M);
+		for(int row = 0; row < M; ++row) {
+			leftRows[row] = this->matrix[row].data();
+			resultRows[row] = result[row].data();
 		}
+		for(int row = 0; row < N; ++row)
+			rightRows[row] = rhs[row].data();
+
+		// Accumulate into the default-constructed result
+		kernels::parallelGemm(leftRows.data(), rightRows.data(), resultRows.data(), M, N, R);
 
 		return std::move(result);
 	}
@@ -221,18 +273,38 @@ namespace matrix {
 	//
 	template <int M, int N, typename T>
 	Matrix<M, N, T>::operator std::string() const {
+		std::vector<const T*> rows(M);
+		for(int row = 0; row < M; ++row)
+			rows[row] = this->matrix[row].data();
+
+		// Format blocks of rows straight into buffers, then join them in order
 		std::string result;
+		text::formatBlocks(rows.data(), M, N, text::Layout::Pipe, [&result] (const std::string& block) {
+			result += block;
+		});
 
-		// Move through the rows
-		for(int row = 0; row < M; ++ row) {
-			for(int column = 0; column < N; ++column) {
-				result += std::to_string(((*this)[row][column]));
-				result += "\t|\t";
-			}
-			result += '\n';
-		}
+		return result;
+	}
 
-		return std::move(result);
+	//
+	// transpose () -> Matrix<N, M, T>
+	//
+	template <int M, int N, typename T>
+	Matrix<N, M, T> Matrix<M, N, T>::transpose() const {
+		Matrix<N, M, T> result;
+
+		// Gather the rows of each side for the blocked kernel
+		std::vector<const T*> sourceRows(M);
+		std::vector<T*> resultRows(N);
+		for(int row = 0; row < M; ++row)
+			sourceRows[row] = this->matrix[row].data();
+		for(int row = 0; row < N; ++row)
+			resultRows[row] = result[row].data();
+
+		kernels::transpose(sourceRows.data(), resultRows.data(), M, N,
+				KernelConfig::getInstance().getTransposeBlockSize());
+
+		return result;
 	}
 
 	// 
@@ -293,13 +365,17 @@ namespace matrix {
 	template <typename Operation>
 	void Matrix<M, N, T>::forEachIndex(const Matrix<M, N, T>& rhs,
 			Operation operation) {
-		// Navigate the 2D Matrix
-		for(int row = 0; row < M; ++row) {
-			for(int col = 0; col < N; ++col) {
-				// Apply the operation and store the returned value to the matrix
-				this->matrix[row][col] = operation(this->matrix[row][col], rhs.matrix[row][col]);
+		// Navigate the 2D Matrix, splitting the rows across the ThreadPool when large
+		kernels::forRows(M, N, [&] (int begin, int end) {
+			for(int row = begin; row < end; ++row) {
+				T* left = this->matrix[row].data();
+				const T* right = rhs.matrix[row].data();
+				for(int col = 0; col < N; ++col) {
+					// Apply the operation and store the returned value to the matrix
+					left[col] = operation(left[col], right[col]);
+				}
 			}
-		}
+		});
 	}
 
 
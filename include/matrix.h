@@ -19,6 +19,8 @@
 #include <stdexcept>
 
 #include "json_util/jsonable.h"
+#include "matrix/kernels.h"
+#include "matrix/text_format.h"
 
 namespace matrix {
 
@@ -70,6 +72,24 @@ namespace matrix {
 			 */
 			Matrix(Matrix&& copy);
 
+			/**
+			 * 	@brief	Copy Assignment
+			 * 
+			 * 	Copies into the existing rows, without reallocating them
+			 * 
+			 * 	@version	0.1
+			 */
+			Matrix& operator = (const Matrix& rhs);
+
+			/**
+			 * 	@brief	Move Assignment
+			 * 
+			 * 	Details
+			 * 
+			 * 	@version	0.1
+			 */
+			Matrix& operator = (Matrix&& rhs);
+
 			/**
 			 * 	@brief 	Build the vector from a JSON object
 			 * 
@@ -201,6 +221,7 @@ namespace matrix {
 			 * 
 			 * 	Demands the sizing requirments that normal matrix multiplication would
 			 * 	Follows the row-column rule, with an O(n^3) complexity
+			 * 	Uses the cache-blocked kernel, split across the ThreadPool for large products
 			 * 	Requires T to be default-constructable
 			 * 
 			 * 	@param	const Matrix<N, R, T>&		right hand side of the multiplication
@@ -246,6 +267,8 @@ namespace matrix {
 			/**
 			 * 	@brief 	Convert the matrix to a string that can be printed
 			 * 
+			 * 	Each value is followed by "\t|\t", one row per line, see text_io.h for other layouts
+			 * 
 			 * 	@param
 			 * 	@return 	std::string
 			 * 
@@ -253,6 +276,15 @@ namespace matrix {
 			 */
 			explicit operator std::string() const;
 
+			/**
+			 * 	@brief 	Build the transpose of the matrix
+			 * 
+			 * 	@return	  Matrix<N, M, T>		Matrix with the rows and columns swapped
+			 * 
+			 * 	@version 0.1
+			 */
+			Matrix<N, M, T> transpose() const;
+
 			/// Get a column in vector form from the matrix
 			std::vector<T> getColumn(unsigned int index) const;
 
@@ -329,4 +361,22 @@ namespace matrix {
 
 #include "matrix/matrix.cpp"
 
+/**
+ * 	Matrix types compiled once into the library by src/matrix_instantiations.cpp.
+ * 	They are declared extern so including this header doesn't instantiate them
+ * 	again in every translation unit, define MATRIX_NO_EXTERN_TEMPLATES to
+ * 	instantiate them locally instead.
+ */
+#define MATRIX_EXPLICIT_INSTANTIATIONS(X) \
+	X(2, 2, int) X(3, 3, int) X(4, 4, int) \
+	X(2, 2, double) X(3, 3, double) X(4, 4, double)
+
+#ifndef MATRIX_NO_EXTERN_TEMPLATES
+namespace matrix {
+#define MATRIX_EXTERN_TEMPLATE(M, N, T) extern template class Matrix<M, N, T>;
+	MATRIX_EXPLICIT_INSTANTIATIONS(MATRIX_EXTERN_TEMPLATE)
+#undef MATRIX_EXTERN_TEMPLATE
+}
+#endif
+
 #endif
\ No newline at end of file
@@ -0,0 +1,298 @@
+/**
+ *  @file		matrix_functions.cpp
+ *  @brief	  Implement the template code for powers and the matrix exponential
+ *
+ * 	Details
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-19-2026
+ *  @version	0.1
+ */
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include "matrix_functions.h"
+
+namespace matrix {
+	/**
+	 * 	@struct		ProductBuffer
+	 * 	@brief		Matrix with its row pointers gathered once for the kernels
+	 *
+	 * 	Moving a buffer keeps the rows where they are, so buffers can be swapped
+	 * 	between products and their row pointers stay valid
+	 *
+	 */
+	template <int N, typename T>
+	struct ProductBuffer {
+		Matrix<N, N, T> value;
+		std::vector<T*> rows;
+
+		ProductBuffer() :
+				rows(N) {
+			for(int row = 0; row < N; ++row)
+				this->rows[row] = this->value[row].data();
+		}
+
+		explicit ProductBuffer(const Matrix<N, N, T>& value) :
+				value(value), rows(N) {
+			for(int row = 0; row < N; ++row)
+				this->rows[row] = this->value[row].data();
+		}
+
+		// A copy would point into the rows of the original
+		ProductBuffer(const ProductBuffer& copy) = delete;
+		ProductBuffer(ProductBuffer&& copy) = default;
+		ProductBuffer& operator = (ProductBuffer&& rhs) = default;
+	};
+
+	/// Overwrite result with lhs * rhs
+	template <int N, typename T>
+	void multiplyInto(const ProductBuffer<N, T>& lhs, const ProductBuffer<N, T>& rhs,
+			ProductBuffer<N, T>& result) {
+		kernels::forRows(N, N, [&result] (int begin, int end) {
+			for(int row = begin; row < end; ++row)
+				std::fill(result.rows[row], result.rows[row] + N, T());
+		});
+		kernels::parallelGemm<T>(lhs.rows.data(), rhs.rows.data(), result.rows.data(), N, N, N);
+	}
+
+	/// Overwrite result with diagonal * I + the sum of coefficient * term
+	template <int N, typename T>
+	void combineInto(ProductBuffer<N, T>& result, T diagonal,
+			const std::vector<std::pair<T, const ProductBuffer<N, T>*>>& terms) {
+		kernels::forRows(N, N * static_cast<int>(terms.size()), [&] (int begin, int end) {
+			for(int row = begin; row < end; ++row) {
+				T* out = result.rows[row];
+				std::fill(out, out + N, T());
+				for(const auto& term : terms) {
+					const T coefficient = term.first;
+					const T* in = term.second->rows[row];
+					for(int column = 0; column < N; ++column)
+						out[column] += coefficient * in[column];
+				}
+				out[row] += diagonal;
+			}
+		});
+	}
+
+	/**
+	 * 	@brief	Overwrite result with the solution X of lhs X = rhs
+	 *
+	 * 	Gaussian elimination with partial pivoting, lhs and rhs are destroyed.
+	 * 	Rows are exchanged through copies of the row pointers, so the buffers
+	 * 	keep their own.
+	 *
+	 * 	@throws   std::domain_error		If lhs is singular
+	 */
+	template <int N, typename T>
+	void solveInto(ProductBuffer<N, T>& lhs, ProductBuffer<N, T>& rhs, ProductBuffer<N, T>& result) {
+		std::vector<T*> left = lhs.rows, right = rhs.rows;
+
+		for(int k = 0; k < N; ++k) {
+			int pivot = k;
+			for(int row = k + 1; row < N; ++row) {
+				if(std::abs(left[row][k]) > std::abs(left[pivot][k]))
+					pivot = row;
+			}
+			if(left[pivot][k] == T() || !std::isfinite(left[pivot][k]))
+				throw std::domain_error("expm could not solve its Pade approximant");
+			std::swap(left[k], left[pivot]);
+			std::swap(right[k], right[pivot]);
+
+			// Eliminate column k from the rows below, each row independently
+			const T* pivotLeft = left[k];
+			const T* pivotRight = right[k];
+			kernels::forRows(N - k - 1, 2 * N, [&] (int begin, int end) {
+				for(int row = k + 1 + begin; row < k + 1 + end; ++row) {
+					const T factor = left[row][k] / pivotLeft[k];
+					for(int column = k + 1; column < N; ++column)
+						left[row][column] -= factor * pivotLeft[column];
+					for(int column = 0; column < N; ++column)
+						right[row][column] -= factor * pivotRight[column];
+				}
+			});
+		}
+
+		// Back substitute from the last row up
+		for(int row = N - 1; row >= 0; --row) {
+			T* out = result.rows[row];
+			std::copy(right[row], right[row] + N, out);
+			for(int k = row + 1; k < N; ++k) {
+				const T factor = left[row][k];
+				const T* solved = result.rows[k];
+				for(int column = 0; column < N; ++column)
+					out[column] -= factor * solved[column];
+			}
+			const T inverse = T(1) / left[row][row];
+			for(int column = 0; column < N; ++column)
+				out[column] *= inverse;
+		}
+	}
+
+	//
+	// identity () -> Matrix<N, N, T>
+	//
+	template <int N, typename T>
+	Matrix<N, N, T> identity() {
+		Matrix<N, N, T> result;
+		for(int i = 0; i < N; ++i)
+			result[i][i] = static_cast<T>(1);
+		return result;
+	}
+
+	//
+	// pow (const Matrix<N, N, T>&, unsigned long long) -> Matrix<N, N, T>
+	//
+	template <int N, typename T>
+	Matrix<N, N, T> pow(const Matrix<N, N, T>& m, unsigned long long exponent) {
+		if(exponent == 0)
+			return identity<N, T>();
+
+		// Walk the bits of the exponent, squaring base as we go and
+		// multiplying it into result for every set bit
+		ProductBuffer<N, T> base(m), result, scratch;
+		bool started = false;
+		while(true) {
+			if(exponent & 1) {
+				if(!started) {
+					result.value = base.value;
+					started = true;
+				}
+				else {
+					multiplyInto(result, base, scratch);
+					std::swap(result, scratch);
+				}
+			}
+
+			exponent >>= 1;
+			if(exponent == 0)
+				break;
+
+			multiplyInto(base, base, scratch);
+			std::swap(base, scratch);
+		}
+
+		return std::move(result.value);
+	}
+
+	//
+	// expm (const Matrix<N, N, T>&) -> Matrix<N, N, T>
+	//
+	template <int N, typename T>
+	Matrix<N, N, T> expm(const Matrix<N, N, T>& m) {
+		static_assert(std::is_floating_point<T>::value, "expm requires a floating point T");
+
+		// Largest 1-norm each degree of approximant is accurate to double precision for
+		constexpr int DEGREES[] = {3, 5, 7, 9, 13};
+		constexpr double THETA[] = {
+			1.495585217958292e-2, 2.539398330063230e-1, 9.504178996162932e-1,
+			2.097847961257068e0, 5.371920351148152e0
+		};
+		// Coefficients b0 ... b13 of the numerator, the denominator alternates their signs
+		constexpr double PADE_3[] = {120.0, 60.0, 12.0, 1.0};
+		constexpr double PADE_5[] = {30240.0, 15120.0, 3360.0, 420.0, 30.0, 1.0};
+		constexpr double PADE_7[] = {17297280.0, 8648640.0, 1995840.0, 277200.0, 25200.0, 1512.0,
+				56.0, 1.0};
+		constexpr double PADE_9[] = {17643225600.0, 8821612800.0, 2075673600.0, 302702400.0,
+				30270240.0, 2162160.0, 110880.0, 3960.0, 90.0, 1.0};
+		constexpr double PADE_13[] = {64764752532480000.0, 32382376266240000.0, 7771770303897600.0,
+				1187353796428800.0, 129060195264000.0, 10559470521600.0, 670442572800.0,
+				33522128640.0, 1323241920.0, 40840800.0, 960960.0, 16380.0, 182.0, 1.0};
+
+		// 1-norm, the largest absolute column sum
+		std::vector<T> columnSums(N, T());
+		for(int row = 0; row < N; ++row) {
+			for(int column = 0; column < N; ++column)
+				columnSums[column] += std::abs(m[row][column]);
+		}
+		double norm = N > 0 ? static_cast<double>(*std::max_element(columnSums.begin(), columnSums.end())) : 0.0;
+		if(!std::isfinite(norm))
+			throw std::domain_error("expm requires a finite matrix");
+
+		int degree = 13;
+		for(int i = 0; i < 4; ++i) {
+			if(norm <= THETA[i]) {
+				degree = DEGREES[i];
+				break;
+			}
+		}
+
+		// Scale m down by 2^squarings so the degree 13 approximant is accurate
+		int squarings = 0;
+		if(degree == 13 && norm > THETA[4])
+			squarings = static_cast<int>(std::ceil(std::log2(norm / THETA[4])));
+
+		ProductBuffer<N, T> A(m), A2, A4, A6, U, V, scratch;
+		if(squarings > 0) {
+			kernels::forRows(N, N, [&A, squarings] (int begin, int end) {
+				for(int row = begin; row < end; ++row) {
+					for(int column = 0; column < N; ++column)
+						A.rows[row][column] = std::ldexp(A.rows[row][column], -squarings);
+				}
+			});
+		}
+
+		// Even powers of A, shared by both halves of the approximant
+		multiplyInto(A, A, A2);
+		if(degree >= 5)
+			multiplyInto(A2, A2, A4);
+		if(degree >= 7)
+			multiplyInto(A4, A2, A6);
+
+		// U = A * (odd coefficients), V = even coefficients, as polynomials in A2
+		using Terms = std::vector<std::pair<T, const ProductBuffer<N, T>*>>;
+		auto b = [] (double coefficient) { return static_cast<T>(coefficient); };
+		if(degree == 13) {
+			const double* c = PADE_13;
+			combineInto(U, T(), Terms{{b(c[13]), &A6}, {b(c[11]), &A4}, {b(c[9]), &A2}});
+			multiplyInto(A6, U, scratch);
+			combineInto(U, b(c[1]), Terms{{T(1), &scratch}, {b(c[7]), &A6}, {b(c[5]), &A4}, {b(c[3]), &A2}});
+			multiplyInto(A, U, scratch);
+			std::swap(U, scratch);
+
+			combineInto(V, T(), Terms{{b(c[12]), &A6}, {b(c[10]), &A4}, {b(c[8]), &A2}});
+			multiplyInto(A6, V, scratch);
+			combineInto(V, b(c[0]), Terms{{T(1), &scratch}, {b(c[6]), &A6}, {b(c[4]), &A4}, {b(c[2]), &A2}});
+		}
+		else {
+			const double* c = degree == 3 ? PADE_3 : degree == 5 ? PADE_5 : degree == 7 ? PADE_7 : PADE_9;
+			ProductBuffer<N, T>* A8 = &U;
+			if(degree == 9)
+				multiplyInto(A6, A2, *A8);
+
+			const ProductBuffer<N, T>* powers[] = {&A2, &A4, &A6, A8};
+			Terms odd, even;
+			for(int k = 1; 2 * k <= degree; ++k) {
+				odd.emplace_back(b(c[2 * k + 1]), powers[k - 1]);
+				even.emplace_back(b(c[2 * k]), powers[k - 1]);
+			}
+			combineInto(scratch, b(c[1]), odd);
+			combineInto(V, b(c[0]), even);
+			multiplyInto(A, scratch, U);
+		}
+
+		// Solve (V - U) X = (V + U), the lhs into scratch and the rhs into V
+		kernels::forRows(N, N, [&] (int begin, int end) {
+			for(int row = begin; row < end; ++row) {
+				for(int column = 0; column < N; ++column) {
+					scratch.rows[row][column] = V.rows[row][column] - U.rows[row][column];
+					V.rows[row][column] += U.rows[row][column];
+				}
+			}
+		});
+		ProductBuffer<N, T>& X = U;
+		solveInto(scratch, V, X);
+
+		// Undo the scaling, e^m = (e^(m / 2^s))^(2^s)
+		for(int i = 0; i < squarings; ++i) {
+			multiplyInto(X, X, scratch);
+			std::swap(X, scratch);
+		}
+
+		return std::move(X.value);
+	}
+}
@@ -0,0 +1,64 @@
+/**
+ *  @file		matrix_functions.h
+ *  @brief	  Define powers and the exponential of square matrices
+ *
+ * 	Both are built from products into preallocated buffers with the
+ * 	parallel GEMM kernel, swapping buffers between steps instead of
+ * 	allocating a new matrix for every product.
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-19-2026
+ *  @version	0.1
+ */
+
+#ifndef MATRIX_FUNCTIONS_H
+#define MATRIX_FUNCTIONS_H
+
+#include <type_traits>
+
+#include "matrix/matrix.h"
+
+namespace matrix {
+
+	/**
+	 * 	@brief	Build the N x N identity matrix
+	 *
+	 * 	@version	0.1
+	 */
+	template <int N, typename T = double>
+	Matrix<N, N, T> identity();
+
+	/**
+	 * 	@brief	Raise m to a non-negative integer power by repeated squaring
+	 *
+	 * 	Takes about 2 log2(exponent) products, m^0 is the identity
+	 *
+	 * 	@param	const Matrix<N, N, T>&		Base
+	 * 	@param	unsigned long long			Exponent
+	 * 	@return	  Matrix<N, N, T>				m^exponent
+	 *
+	 * 	@version	0.1
+	 */
+	template <int N, typename T>
+	Matrix<N, N, T> pow(const Matrix<N, N, T>& m, unsigned long long exponent);
+
+	/**
+	 * 	@brief	Compute the matrix exponential e^m
+	 *
+	 * 	Scaling and squaring with a Pade approximant of degree 3 to 13, chosen
+	 * 	from the 1-norm of m (Higham, "The Scaling and Squaring Method for the
+	 * 	Matrix Exponential Revisited", 2005)
+	 *
+	 * 	@param	const Matrix<N, N, T>&		Exponent, T a floating point type
+	 * 	@return	  Matrix<N, N, T>				e^m
+	 * 	@throws   std::domain_error			If the approximant can't be solved, when m isn't finite
+	 *
+	 * 	@version	0.1
+	 */
+	template <int N, typename T>
+	Matrix<N, N, T> expm(const Matrix<N, N, T>& m);
+}
+
+#include "matrix/matrix_functions.cpp"
+
+#endif
@@ -0,0 +1,203 @@
+/**
+ *  @file		reduction.cpp
+ *  @brief	  Implement the template code for reductions, broadcasting and maps
+ *
+ * 	Details
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-19-2026
+ *  @version	0.1
+ */
+
+#include <vector>
+#include <algorithm>
+
+#include "reduction.h"
+
+namespace matrix {
+	//
+	// mapReduce (const Matrix<M, N, T>&, const U&, Map, Reduce) -> AxisResult<A, M, N, U>
+	//
+	template <Axis A, int M, int N, typename T, typename U, typename Map, typename Reduce>
+	AxisResult<A, M, N, U> mapReduce(const Matrix<M, N, T>& m, const U& identity, Map map, Reduce reduce) {
+		if constexpr(A == Axis::Columns) {
+			// Each row reduces to its own value, so rows split freely
+			Matrix<M, 1, U> result;
+			kernels::forRows(M, N, [&] (int begin, int end) {
+				for(int row = begin; row < end; ++row)
+					result[row][0] = kernels::reduceRow(m[row].data(), N, identity, map, reduce);
+			});
+
+			return result;
+		}
+		else if constexpr(A == Axis::Rows) {
+			// Each strip of columns folds every row into its own slice of the result
+			Matrix<1, N, U> result(identity);
+			U* out = result[0].data();
+			kernels::forColumns(M, N, [&] (int begin, int end) {
+				for(int row = 0; row < M; ++row) {
+					const T* values = m[row].data();
+					for(int column = begin; column < end; ++column)
+						out[column] = reduce(out[column], map(values[column]));
+				}
+			});
+
+			return result;
+		}
+		else {
+			// Each block of rows folds into a partial value, combined in block order
+			std::vector<U> partials(M, identity);
+			int blocks = kernels::forRowBlocks(M, N, [&] (int block, int begin, int end) {
+				U partial = identity;
+				for(int row = begin; row < end; ++row)
+					partial = reduce(partial, kernels::reduceRow(m[row].data(), N, identity, map, reduce));
+				partials[block] = partial;
+			});
+
+			U result = identity;
+			for(int block = 0; block < blocks; ++block)
+				result = reduce(result, partials[block]);
+
+			return result;
+		}
+	}
+
+	//
+	// reduce (const Matrix<M, N, T>&, const T&, Reduce) -> AxisResult<A, M, N, T>
+	//
+	template <Axis A, int M, int N, typename T, typename Reduce>
+	AxisResult<A, M, N, T> reduce(const Matrix<M, N, T>& m, const T& identity, Reduce reduce) {
+		return mapReduce<A>(m, identity, [] (const T& value) { return value; }, reduce);
+	}
+
+	//
+	// sum (const Matrix<M, N, T>&) -> AxisResult<A, M, N, T>
+	//
+	template <Axis A, int M, int N, typename T>
+	AxisResult<A, M, N, T> sum(const Matrix<M, N, T>& m) {
+		return reduce<A>(m, T(), [] (const T& left, const T& right) { return left + right; });
+	}
+
+	//
+	// mean (const Matrix<M, N, T>&) -> AxisResult<A, M, N, Real<T>>
+	//
+	template <Axis A, int M, int N, typename T>
+	AxisResult<A, M, N, Real<T>> mean(const Matrix<M, N, T>& m) {
+		using R = Real<T>;
+		constexpr int COUNT = (A == Axis::All) ? M * N : (A == Axis::Rows ? M : N);
+
+		// Sum in R, so integral values neither truncate nor overflow
+		AxisResult<A, M, N, R> result = mapReduce<A>(m, R(),
+				[] (const T& value) { return static_cast<R>(value); },
+				[] (const R& left, const R& right) { return left + right; });
+
+		if constexpr(A == Axis::All)
+			return result / static_cast<R>(COUNT);
+		else
+			return map(result, [] (const R& value) { return value / static_cast<R>(COUNT); });
+	}
+
+	//
+	// min (const Matrix<M, N, T>&) -> AxisResult<A, M, N, T>
+	//
+	template <Axis A, int M, int N, typename T>
+	AxisResult<A, M, N, T> min(const Matrix<M, N, T>& m) {
+		// Infinity, so a matrix of infinities reduces to infinity rather than max()
+		constexpr T identity = std::numeric_limits<T>::has_infinity ?
+				std::numeric_limits<T>::infinity() : std::numeric_limits<T>::max();
+		return reduce<A>(m, identity, [] (const T& left, const T& right) {
+			return right < left ? right : left;
+		});
+	}
+
+	//
+	// max (const Matrix<M, N, T>&) -> AxisResult<A, M, N, T>
+	//
+	template <Axis A, int M, int N, typename T>
+	AxisResult<A, M, N, T> max(const Matrix<M, N, T>& m) {
+		constexpr T identity = std::numeric_limits<T>::has_infinity ?
+				-std::numeric_limits<T>::infinity() : std::numeric_limits<T>::lowest();
+		return reduce<A>(m, identity, [] (const T& left, const T& right) {
+			return left < right ? right : left;
+		});
+	}
+
+	//
+	// norm (const Matrix<M, N, T>&) -> AxisResult<A, M, N, Real<T>>
+	//
+	template <Axis A, int M, int N, typename T>
+	AxisResult<A, M, N, Real<T>> norm(const Matrix<M, N, T>& m) {
+		using R = Real<T>;
+		static_assert(std::is_floating_point<R>::value, "norm requires an integral or floating point T");
+
+		AxisResult<A, M, N, R> squares = mapReduce<A>(m, R(),
+				[] (const T& value) { return static_cast<R>(value) * static_cast<R>(value); },
+				[] (const R& left, const R& right) { return left + right; });
+
+		if constexpr(A == Axis::All)
+			return std::sqrt(squares);
+		else
+			return map(squares, [] (const R& value) { return std::sqrt(value); });
+	}
+
+	//
+	// map (const Matrix<M, N, T>&, Map) -> Matrix<M, N, U>
+	//
+	template <int M, int N, typename T, typename Map>
+	auto map(const Matrix<M, N, T>& m, Map map) -> Matrix<M, N, std::invoke_result_t<Map&, const T&>> {
+		Matrix<M, N, std::invoke_result_t<Map&, const T&>> result;
+
+		kernels::forRows(M, N, [&] (int begin, int end) {
+			for(int row = begin; row < end; ++row) {
+				const T* values = m[row].data();
+				auto* out = result[row].data();
+				for(int column = 0; column < N; ++column)
+					out[column] = map(values[column]);
+			}
+		});
+
+		return result;
+	}
+
+	//
+	// broadcastRow (const Matrix<M, N, T>&, const Matrix<1, N, T>&, Operation) -> Matrix<M, N, T>
+	//
+	template <int M, int N, typename T, typename Operation>
+	Matrix<M, N, T> broadcastRow(const Matrix<M, N, T>& m, const Matrix<1, N, T>& row,
+			Operation operation) {
+		Matrix<M, N, T> result;
+		const T* vector = row[0].data();
+
+		kernels::forRows(M, N, [&] (int begin, int end) {
+			for(int i = begin; i < end; ++i) {
+				const T* values = m[i].data();
+				T* out = result[i].data();
+				for(int column = 0; column < N; ++column)
+					out[column] = operation(values[column], vector[column]);
+			}
+		});
+
+		return result;
+	}
+
+	//
+	// broadcastColumn (const Matrix<M, N, T>&, const Matrix<M, 1, T>&, Operation) -> Matrix<M, N, T>
+	//
+	template <int M, int N, typename T, typename Operation>
+	Matrix<M, N, T> broadcastColumn(const Matrix<M, N, T>& m, const Matrix<M, 1, T>& column,
+			Operation operation) {
+		Matrix<M, N, T> result;
+
+		kernels::forRows(M, N, [&] (int begin, int end) {
+			for(int i = begin; i < end; ++i) {
+				const T* values = m[i].data();
+				const T scalar = column[i][0];
+				T* out = result[i].data();
+				for(int j = 0; j < N; ++j)
+					out[j] = operation(values[j], scalar);
+			}
+		});
+
+		return result;
+	}
+}
@@ -0,0 +1,124 @@
+/**
+ *  @file		reduction.h
+ *  @brief	  Define reductions, broadcasting and elementwise maps over a Matrix
+ *
+ * 	Functors are template parameters so they inline into the loops.  Work is
+ * 	split into fixed blocks of rows across the ThreadPool, and partial results
+ * 	are combined in block order, so results don't depend on the number of threads.
+ * 	Reductions down the columns split into strips of columns instead, each
+ * 	folding every row in order into its own part of the result.
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-19-2026
+ *  @version	0.1
+ */
+
+#ifndef REDUCTION_H
+#define REDUCTION_H
+
+#include <type_traits>
+#include <functional>
+#include <limits>
+#include <cmath>
+
+#include "matrix/matrix.h"
+
+namespace matrix {
+
+	/**
+	 * 	@brief	Which values a reduction combines
+	 *
+	 * 	Rows is axis 0: combine down each column, giving one row (1 x N)
+	 * 	Columns is axis 1: combine across each row, giving one column (M x 1)
+	 * 	All: combine every value, giving a single value
+	 */
+	enum class Axis { Rows, Columns, All };
+
+	/// Result of reducing an M x N matrix of U along an Axis
+	template <Axis A, int M, int N, typename U>
+	using AxisResult = std::conditional_t<A == Axis::All, U,
+			std::conditional_t<A == Axis::Rows, Matrix<1, N, U>, Matrix<M, 1, U>>>;
+
+	/// Type mean() and norm() work in for T, double when T is integral
+	template <typename T>
+	using Real = std::conditional_t<std::is_integral<T>::value, double, T>;
+
+	/**
+	 * 	@brief	Map every value, then combine the mapped values along an axis
+	 *
+	 * 	reduce must be associative and commutative, and identity its identity
+	 * 	element (0 for +, lowest for max, ...), values are combined in any grouping
+	 *
+	 * 	@param	const Matrix<M, N, T>&		Matrix to reduce
+	 * 	@param	const U&						Identity of reduce
+	 * 	@param	Map								U(const T&) applied to each value
+	 * 	@param	Reduce							U(const U&, const U&) combining values
+	 * 	@return	  AxisResult<A, M, N, U>		Value, row or column of results
+	 *
+	 * 	@version	0.1
+	 */
+	template <Axis A = Axis::All, int M, int N, typename T, typename U, typename Map, typename Reduce>
+	AxisResult<A, M, N, U> mapReduce(const Matrix<M, N, T>& m, const U& identity, Map map, Reduce reduce);
+
+	/// Combine the values along an axis, see mapReduce()
+	template <Axis A = Axis::All, int M, int N, typename T, typename Reduce>
+	AxisResult<A, M, N, T> reduce(const Matrix<M, N, T>& m, const T& identity, Reduce reduce);
+
+	/// Sum the values along an axis
+	template <Axis A = Axis::All, int M, int N, typename T>
+	AxisResult<A, M, N, T> sum(const Matrix<M, N, T>& m);
+
+	/// Average the values along an axis, summing integral values as double
+	template <Axis A = Axis::All, int M, int N, typename T>
+	AxisResult<A, M, N, Real<T>> mean(const Matrix<M, N, T>& m);
+
+	/// Find the least value along an axis
+	template <Axis A = Axis::All, int M, int N, typename T>
+	AxisResult<A, M, N, T> min(const Matrix<M, N, T>& m);
+
+	/// Find the greatest value along an axis
+	template <Axis A = Axis::All, int M, int N, typename T>
+	AxisResult<A, M, N, T> max(const Matrix<M, N, T>& m);
+
+	/// Euclidean norm along an axis, the Frobenius norm for Axis::All, as double for integral values
+	template <Axis A = Axis::All, int M, int N, typename T>
+	AxisResult<A, M, N, Real<T>> norm(const Matrix<M, N, T>& m);
+
+	/**
+	 * 	@brief	Apply a function to every value
+	 *
+	 * 	@param	const Matrix<M, N, T>&		Matrix to map
+	 * 	@param	Map								U(const T&)
+	 * 	@return	  Matrix<M, N, U>				Mapped values
+	 *
+	 * 	@version	0.1
+	 */
+	template <int M, int N, typename T, typename Map>
+	auto map(const Matrix<M, N, T>& m, Map map) -> Matrix<M, N, std::invoke_result_t<Map&, const T&>>;
+
+	/**
+	 * 	@brief	Combine every row of m with a row vector
+	 *
+	 * 	result[i][j] = operation(m[i][j], row[0][j])
+	 *
+	 * 	@version	0.1
+	 */
+	template <int M, int N, typename T, typename Operation>
+	Matrix<M, N, T> broadcastRow(const Matrix<M, N, T>& m, const Matrix<1, N, T>& row,
+			Operation operation);
+
+	/**
+	 * 	@brief	Combine every column of m with a column vector
+	 *
+	 * 	result[i][j] = operation(m[i][j], column[i][0])
+	 *
+	 * 	@version	0.1
+	 */
+	template <int M, int N, typename T, typename Operation>
+	Matrix<M, N, T> broadcastColumn(const Matrix<M, N, T>& m, const Matrix<M, 1, T>& column,
+			Operation operation);
+}
+
+#include "matrix/reduction.cpp"
+
+#endif
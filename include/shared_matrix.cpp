@@ -0,0 +1,87 @@
+/**
+ *  @file		shared_matrix.cpp
+ *  @brief	  Implement the template code for the copy-on-write matrix handle
+ *
+ * 	Details
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-19-2026
+ *  @version	0.1
+ */
+
+#include "shared_matrix.h"
+
+namespace matrix {
+	//
+	// Default Constructor
+	//
+	template <int M, int N, typename T>
+	SharedMatrix<M, N, T>::SharedMatrix() :
+			shared(std::make_shared<Matrix<M, N, T>>()) {
+
+	}
+
+	//
+	// Fill Constructor
+	//
+	template <int M, int N, typename T>
+	SharedMatrix<M, N, T>::SharedMatrix(T value) :
+			shared(std::make_shared<Matrix<M, N, T>>(value)) {
+
+	}
+
+	//
+	// Matrix Constructor
+	//
+	template <int M, int N, typename T>
+	SharedMatrix<M, N, T>::SharedMatrix(Matrix<M, N, T> matrix) :
+			shared(std::make_shared<Matrix<M, N, T>>(std::move(matrix))) {
+
+	}
+
+	//
+	// mutate () -> Matrix<M, N, T>&
+	//
+	template <int M, int N, typename T>
+	Matrix<M, N, T>& SharedMatrix<M, N, T>::mutate() {
+		if(!this->shared)
+			throw std::logic_error("Cannot modify a SharedMatrix that was moved from");
+
+		if(this->shared.use_count() != 1)
+			this->shared = std::make_shared<Matrix<M, N, T>>(*this->shared);
+		else {
+			// The last other owner released with a release decrement,
+			// synchronize with it so its reads finish before these writes
+			std::atomic_thread_fence(std::memory_order_acquire);
+		}
+
+		return *this->shared;
+	}
+
+	//
+	// operator += (const Matrix<M, N, T>&) -> SharedMatrix<M, N, T>&
+	//
+	template <int M, int N, typename T>
+	SharedMatrix<M, N, T>& SharedMatrix<M, N, T>::operator += (const Matrix<M, N, T>& rhs) {
+		this->mutate() += rhs;
+		return *this;
+	}
+
+	//
+	// operator -= (const Matrix<M, N, T>&) -> SharedMatrix<M, N, T>&
+	//
+	template <int M, int N, typename T>
+	SharedMatrix<M, N, T>& SharedMatrix<M, N, T>::operator -= (const Matrix<M, N, T>& rhs) {
+		this->mutate() -= rhs;
+		return *this;
+	}
+
+	//
+	// operator *= (const T&) -> SharedMatrix<M, N, T>&
+	//
+	template <int M, int N, typename T>
+	SharedMatrix<M, N, T>& SharedMatrix<M, N, T>::operator *= (const T& scalar) {
+		this->mutate() *= scalar;
+		return *this;
+	}
+}
@@ -0,0 +1,157 @@
+/**
+ *  @file		shared_matrix.h
+ *  @brief	  Define a Matrix handle that shares its buffer until it is modified
+ *
+ * 	Copying a SharedMatrix only copies a pointer and bumps an atomic
+ * 	reference count, so one large matrix can be handed to many readers
+ * 	(including other threads) cheaply.  The first mutation through a handle
+ * 	that isn't the only owner copies the buffer (copy-on-write).
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-19-2026
+ *  @version	0.1
+ */
+
+#ifndef SHARED_MATRIX_H
+#define SHARED_MATRIX_H
+
+#include <memory>
+#include <atomic>
+#include <stdexcept>
+
+#include "matrix/matrix.h"
+
+namespace matrix {
+
+	/**
+	 * 	@class		SharedMatrix
+	 * 	@brief		Copy-on-write handle to a Matrix<M, N, T>
+	 *
+	 * 	Separate handles may be used from separate threads; one handle must
+	 * 	not be modified by one thread while another thread uses it.
+	 * 	References returned by the non-const accessors are invalidated when
+	 * 	the handle is copied and then modified again.
+	 *
+	 */
+	template <int M = 3, int N = 3, typename T = double>
+	class SharedMatrix : public json::JSONAble {
+		public:
+			/**
+			 * 	@brief	Default Constructor
+			 *
+			 * 	Owns a new default Matrix
+			 *
+			 * 	@version	0.1
+			 */
+			SharedMatrix();
+
+			/**
+			 * 	@brief	Fill Constructor
+			 *
+			 * 	Owns a new Matrix filled with the value provided
+			 *
+			 * 	@version	0.1
+			 */
+			explicit SharedMatrix(T value);
+
+			/**
+			 * 	@brief	Take over a Matrix, move it in to avoid a copy
+			 *
+			 * 	Explicit, so a Matrix is never copied into a handle by accident
+			 *
+			 * 	@version	0.2
+			 */
+			explicit SharedMatrix(Matrix<M, N, T> matrix);
+
+			/**
+			 * 	@brief	Copy Constructor
+			 *
+			 * 	Shares the buffer of copy
+			 *
+			 * 	@version	0.1
+			 */
+			SharedMatrix(const SharedMatrix& copy) = default;
+
+			/// Move Constructor
+			SharedMatrix(SharedMatrix&& copy) = default;
+
+			/// Share the buffer of rhs
+			SharedMatrix& operator = (const SharedMatrix& rhs) = default;
+
+			/// Take the buffer of rhs
+			SharedMatrix& operator = (SharedMatrix&& rhs) = default;
+
+			// ----- Read access, never copies -----
+			/// Get the matrix for reading
+			inline const Matrix<M, N, T>& get() const { return *this->shared; }
+
+			/// Read the matrix wherever a const Matrix& is expected
+			inline operator const Matrix<M, N, T>& () const { return *this->shared; }
+
+			/// Overload for an r-value of the array-subscript operator
+			inline const std::vector<T>& operator [] (unsigned int index) const {
+				return (*this->shared)[index];
+			}
+
+			/// Compare the contents of two handles, without copying
+			inline bool operator == (const SharedMatrix<M, N, T>& rhs) const {
+				return this->shared == rhs.shared || *this->shared == *rhs.shared;
+			}
+
+			/// Compare the contents of two handles for in-equivalency
+			inline bool operator != (const SharedMatrix<M, N, T>& rhs) const { return !(*this == rhs); }
+
+			/// Multiply with a matrix
+			template <int R>
+			Matrix<M, R, T> operator * (const Matrix<N, R, T>& rhs) const { return this->get() * rhs; }
+
+			/// Multiply with the matrix of another handle
+			template <int R>
+			Matrix<M, R, T> operator * (const SharedMatrix<N, R, T>& rhs) const {
+				return this->get() * rhs.get();
+			}
+
+			// ----- Write access, copies the buffer first if it is shared -----
+			/**
+			 * 	@brief	Get the matrix for writing
+			 *
+			 * 	Copies the buffer first if any other handle shares it
+			 *
+			 * 	@return	  Matrix<M, N, T>&	Matrix owned by this handle alone
+			 * 	@throws   std::logic_error		If the handle was moved from
+			 *
+			 * 	@version	0.2
+			 */
+			Matrix<M, N, T>& mutate();
+
+			/// Overload for an l-value of the array-subscript operator, copies a shared buffer
+			inline std::vector<T>& operator [] (unsigned int index) { return this->mutate()[index]; }
+
+			/// Add a matrix of equivalent dimension, copies a shared buffer
+			SharedMatrix<M, N, T>& operator += (const Matrix<M, N, T>& rhs);
+
+			/// Subtract a matrix of equivalent dimension, copies a shared buffer
+			SharedMatrix<M, N, T>& operator -= (const Matrix<M, N, T>& rhs);
+
+			/// Multiply by a scalar, copies a shared buffer
+			SharedMatrix<M, N, T>& operator *= (const T& scalar);
+
+			// ----- Sharing -----
+			/// Check if another handle shares the buffer
+			inline bool isShared() const { return this->shared.use_count() > 1; }
+
+			/// Get the number of handles sharing the buffer
+			inline long useCount() const { return this->shared.use_count(); }
+
+			/// Get the json form of the Matrix
+			virtual json::JSON getJSON() const { return this->shared->getJSON(); }
+
+		private:
+			/// Buffer, possibly shared with other handles
+			std::shared_ptr<Matrix<M, N, T>> shared;
+	};
+}
+
+#include "matrix/shared_matrix.cpp"
+
+#endif
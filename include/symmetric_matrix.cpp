@@ -0,0 +1,168 @@
+/**
+ *  @file		symmetric_matrix.cpp
+ *  @brief	  Implement the template code for a packed symmetric matrix
+ *
+ * 	Details
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-19-2026
+ *  @version	0.1
+ */
+
+#include "symmetric_matrix.h"
+
+namespace matrix {
+	//
+	// Fill Constructor
+	//
+	template <int N, typename T>
+	SymmetricMatrix<N, T>::SymmetricMatrix(T value) :
+			packed(PACKED_SIZE, value) {
+
+	}
+
+	//
+	// Dense Constructor
+	//
+	template <int N, typename T>
+	SymmetricMatrix<N, T>::SymmetricMatrix(const Matrix<N, N, T>& dense) :
+			packed(PACKED_SIZE) {
+		for(int row = 0; row < N; ++row) {
+			for(int column = 0; column <= row; ++column)
+				this->packed[index(row, column)] = dense[row][column];
+		}
+	}
+
+	//
+	// get (int, int) -> T
+	//
+	template <int N, typename T>
+	T SymmetricMatrix<N, T>::get(int row, int column) const {
+		if(row < 0 || row >= N || column < 0 || column >= N)
+			throw std::out_of_range("Index must be within the matrix");
+
+		return this->packed[index(row, column)];
+	}
+
+	//
+	// set (int, int, const T&) -> void
+	//
+	template <int N, typename T>
+	void SymmetricMatrix<N, T>::set(int row, int column, const T& value) {
+		if(row < 0 || row >= N || column < 0 || column >= N)
+			throw std::out_of_range("Index must be within the matrix");
+
+		this->packed[index(row, column)] = value;
+	}
+
+	//
+	// operator * (const Matrix<N, R, T>&) -> Matrix<N, R, T>
+	//
+	template <int N, typename T>
+	template <int R>
+	Matrix<N, R, T> SymmetricMatrix<N, T>::operator * (const Matrix<N, R, T>& rhs) const {
+		Matrix<N, R, T> result;
+
+		// Each worker owns its output rows: (row, k) comes from packed row "row" up to the
+		// diagonal, then from column "row" of the packed rows below, one row further each step
+		kernels::forRows(N, static_cast<long long>(N) * R, [&] (int begin, int end) {
+			for(int row = begin; row < end; ++row) {
+				T* out = result[row].data();
+				const T* coefficients = this->packed.data() + rowStart(row);
+				for(int k = 0; k <= row; ++k) {
+					const T scalar = coefficients[k];
+					const T* right = rhs[k].data();
+					for(int column = 0; column < R; ++column)
+						out[column] += scalar * right[column];
+				}
+
+				std::size_t mirrored = rowStart(row + 1) + row;
+				for(int k = row + 1; k < N; mirrored += ++k) {
+					const T scalar = this->packed[mirrored];
+					const T* right = rhs[k].data();
+					for(int column = 0; column < R; ++column)
+						out[column] += scalar * right[column];
+				}
+			}
+		});
+
+		return result;
+	}
+
+	//
+	// toDense () -> Matrix<N, N, T>
+	//
+	template <int N, typename T>
+	Matrix<N, N, T> SymmetricMatrix<N, T>::toDense() const {
+		Matrix<N, N, T> result;
+		for(int row = 0; row < N; ++row) {
+			for(int column = 0; column <= row; ++column) {
+				result[row][column] = this->packed[index(row, column)];
+				result[column][row] = this->packed[index(row, column)];
+			}
+		}
+
+		return result;
+	}
+
+	//
+	// rankUpdate (const Matrix<N, K, T>&, const T&, const T&) -> SymmetricMatrix<N, T>&
+	//
+	template <int N, typename T>
+	template <int K>
+	SymmetricMatrix<N, T>& SymmetricMatrix<N, T>::rankUpdate(const Matrix<N, K, T>& a,
+			const T& alpha, const T& beta) {
+		// Rows of the packed triangle are independent, so split them across the pool
+		kernels::forRows(N, static_cast<long long>(N) * K / 2, [&] (int begin, int end) {
+			for(int row = begin; row < end; ++row) {
+				T* out = this->packed.data() + rowStart(row);
+				const T* left = a[row].data();
+
+				for(int column = 0; column <= row; ++column) {
+					const T* right = a[column].data();
+					T dot = T();
+					for(int k = 0; k < K; ++k)
+						dot += left[k] * right[k];
+					out[column] = alpha * dot + beta * out[column];
+				}
+			}
+		});
+
+		return *this;
+	}
+
+	//
+	// operator * (const Matrix<M, N, T>&, const SymmetricMatrix<N, T>&) -> Matrix<M, N, T>
+	//
+	template <int M, int N, typename T>
+	Matrix<M, N, T> operator * (const Matrix<M, N, T>& lhs, const SymmetricMatrix<N, T>& rhs) {
+		Matrix<M, N, T> result;
+		const T* packed = rhs.getPacked().data();
+
+		kernels::forRows(M, static_cast<long long>(N) * N, [&] (int begin, int end) {
+			for(int row = begin; row < end; ++row) {
+				T* out = result[row].data();
+				const T* left = lhs[row].data();
+
+				// (k, column) for column <= k is packed row k
+				for(int k = 0; k < N; ++k) {
+					const T scalar = left[k];
+					const T* coefficients = packed + SymmetricMatrix<N, T>::rowStart(k);
+					for(int column = 0; column <= k; ++column)
+						out[column] += scalar * coefficients[column];
+				}
+
+				// (k, column) for k < column is the mirror, packed row column
+				for(int column = 1; column < N; ++column) {
+					const T* coefficients = packed + SymmetricMatrix<N, T>::rowStart(column);
+					T dot = T();
+					for(int k = 0; k < column; ++k)
+						dot += left[k] * coefficients[k];
+					out[column] += dot;
+				}
+			}
+		});
+
+		return result;
+	}
+}
@@ -0,0 +1,132 @@
+/**
+ *  @file		symmetric_matrix.h
+ *  @brief	  Define a square matrix equal to its transpose, storing only its lower triangle
+ *
+ * 	Details
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-19-2026
+ *  @version	0.1
+ */
+
+#ifndef SYMMETRIC_MATRIX_H
+#define SYMMETRIC_MATRIX_H
+
+#include <vector>
+#include <stdexcept>
+#include <algorithm>
+
+#include "matrix/matrix.h"
+
+namespace matrix {
+
+	/**
+	 * 	@class		SymmetricMatrix
+	 * 	@brief		N x N matrix where (row, column) == (column, row)
+	 *
+	 * 	Stores the N(N+1)/2 entries of the lower triangle row by row
+	 *
+	 */
+	template <int N = 3, typename T = double>
+	class SymmetricMatrix {
+		public:
+			/// Number of stored entries
+			static constexpr std::size_t PACKED_SIZE = static_cast<std::size_t>(N) * (N + 1) / 2;
+
+			/**
+			 * 	@brief	Fill Constructor
+			 *
+			 * 	Fills every entry with the value provided
+			 *
+			 * 	@version	0.1
+			 */
+			explicit SymmetricMatrix(T value = T());
+
+			/**
+			 * 	@brief	Build from the lower triangle of a dense matrix
+			 *
+			 * 	The upper triangle of dense is ignored
+			 *
+			 * 	@version	0.1
+			 */
+			explicit SymmetricMatrix(const Matrix<N, N, T>& dense);
+
+			/// Get the entry at (row, column)
+			T get(int row, int column) const;
+
+			/// Set the entry at (row, column), and so (column, row)
+			void set(int row, int column, const T& value);
+
+			/**
+			 * 	@brief	Multiply with a dense matrix, across the ThreadPool by rows of the product
+			 *
+			 * 	Entries above the diagonal are read from their mirror in the lower triangle
+			 *
+			 * 	@version	0.2
+			 */
+			template <int R>
+			Matrix<N, R, T> operator * (const Matrix<N, R, T>& rhs) const;
+
+			/// Build the dense form of the matrix
+			Matrix<N, N, T> toDense() const;
+
+			/// Get the packed lower triangle, row by row
+			inline const std::vector<T>& getPacked() const { return this->packed; }
+
+			/// Get the width of the Matrix
+			inline int getWidth() const { return N; }
+
+			/// Get the number of rows in the matrix
+			inline int getHeight() const { return N; }
+
+			/**
+			 * 	@brief	Symmetric rank-k update: this = alpha * A * A^T + beta * this
+			 *
+			 * 	Only computes the lower triangle, half the work of the dense product
+			 *
+			 * 	@param	const Matrix<N, K, T>&		A
+			 * 	@param	const T&						alpha
+			 * 	@param	const T&						beta
+			 * 	@return	  SymmetricMatrix<N, T>&	Reference to this
+			 *
+			 * 	@version	0.1
+			 */
+			template <int K>
+			SymmetricMatrix<N, T>& rankUpdate(const Matrix<N, K, T>& a, const T& alpha, const T& beta);
+
+			/// Index into packed of the first entry of a row
+			static inline std::size_t rowStart(int row) {
+				return static_cast<std::size_t>(row) * (row + 1) / 2;
+			}
+
+			/// Index into packed of (row, column), either order
+			static inline std::size_t index(int row, int column) {
+				if(column > row)
+					std::swap(row, column);
+				return rowStart(row) + column;
+			}
+
+		private:
+			/// Lower triangle, row by row
+			std::vector<T> packed;
+	};
+
+	/**
+	 * 	@brief	Multiply a dense matrix with a symmetric one, across the ThreadPool by rows
+	 *
+	 * 	The lower triangle of rhs is added row by row, the upper as dot products
+	 * 	of lhs rows with the packed rows, so both are read contiguously
+	 *
+	 * 	@param	const Matrix<M, N, T>&				Left hand side
+	 * 	@param	const SymmetricMatrix<N, T>&		Right hand side
+	 * 	@return	  Matrix<M, N, T>						The product
+	 *
+	 * 	@version	0.1
+	 */
+	template <int M, int N, typename T>
+	Matrix<M, N, T> operator * (const Matrix<M, N, T>& lhs, const SymmetricMatrix<N, T>& rhs);
+}
+
+#include "matrix/symmetric_matrix.cpp"
+
+#endif
@@ -0,0 +1,207 @@
+/**
+ *  @file		text_format.h
+ *  @brief	  Define the row-level text formatting and parsing behind the matrix text I/O
+ *
+ * 	Numbers are written with std::to_chars (shortest round-trip for floating
+ * 	point) into preallocated buffers and read back with std::from_chars, so
+ * 	neither direction depends on the locale.  Like the kernels these work on
+ * 	arrays of row pointers.
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-19-2026
+ *  @version	0.1
+ */
+
+#ifndef TEXT_FORMAT_H
+#define TEXT_FORMAT_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <charconv>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+#include "matrix/kernel_config.h"
+#include "matrix/thread_pool.h"
+
+namespace matrix {
+	namespace text {
+
+		/// How values and rows are laid out in text
+		enum class Layout {
+			/// Every value followed by "\t|\t", one row per line (the string form of a Matrix)
+			Pipe,
+			/// Values separated by ',', one row per line
+			CSV,
+			/// Values separated by '\t', one row per line
+			TSV
+		};
+
+		/// Number of rows formatted together as one block
+		static constexpr int BLOCK_ROWS = 64;
+
+		/// Most characters std::to_chars writes for one value of T
+		template <typename T>
+		constexpr std::size_t maxChars() {
+			static_assert(std::is_arithmetic<T>::value, "Text formatting requires an arithmetic T");
+			if constexpr(std::is_floating_point<T>::value)
+				return std::numeric_limits<T>::max_digits10 + 10;
+			else
+				return std::numeric_limits<T>::digits10 + 3;
+		}
+
+		/// Get the separator written after each value (Pipe) or between values (CSV, TSV)
+		inline std::string_view separator(Layout layout) {
+			switch(layout) {
+				case Layout::Pipe:
+					return "\t|\t";
+				case Layout::CSV:
+					return ",";
+				default:
+					return "\t";
+			}
+		}
+
+		/**
+		 * 	@brief	Append rows [begin, end) to out
+		 *
+		 * 	Grows out once for the worst case, then writes straight into it
+		 *
+		 * 	@param	const T* const*		Rows to format
+		 * 	@param	int						First row to format
+		 * 	@param	int						One past the last row to format
+		 * 	@param	int						Number of values in each row
+		 * 	@param	Layout					Layout to write
+		 * 	@param	std::string&			Buffer appended to
+		 *
+		 * 	@version	0.1
+		 */
+		template <typename T>
+		void formatRows(const T* const* rows, int begin, int end, int columns,
+				Layout layout, std::string& out) {
+			std::string_view between = separator(layout);
+			bool trailing = (layout == Layout::Pipe);
+
+			std::size_t start = out.size();
+			out.resize(start + static_cast<std::size_t>(end - begin) *
+					(columns * (maxChars<T>() + between.size()) + 1));
+			char* position = &out[start];
+			char* limit = out.data() + out.size();
+
+			for(int row = begin; row < end; ++row) {
+				for(int column = 0; column < columns; ++column) {
+					if(column > 0 && !trailing) {
+						between.copy(position, between.size());
+						position += between.size();
+					}
+					position = std::to_chars(position, limit, rows[row][column]).ptr;
+					if(trailing) {
+						between.copy(position, between.size());
+						position += between.size();
+					}
+				}
+				*position++ = '\n';
+			}
+
+			out.resize(position - out.data());
+		}
+
+		/**
+		 * 	@brief	Format every row, handing the text to sink in order, one group of blocks at a time
+		 *
+		 * 	Blocks of BLOCK_ROWS rows are formatted in parallel when the matrix is large,
+		 * 	sink is called as sink(const std::string&) on the calling thread
+		 *
+		 * 	@version	0.1
+		 */
+		template <typename T, typename Sink>
+		void formatBlocks(const T* const* rows, int count, int columns, Layout layout, Sink sink) {
+			if(static_cast<long>(count) * columns < KernelConfig::getInstance().getElementwiseThreshold()) {
+				std::string out;
+				formatRows(rows, 0, count, columns, layout, out);
+				sink(out);
+				return;
+			}
+
+			// Bound the memory held at once to a few blocks per worker
+			ThreadPool& pool = ThreadPool::getInstance();
+			int blocks = (count + BLOCK_ROWS - 1) / BLOCK_ROWS;
+			int group = static_cast<int>(pool.size()) * 4;
+			std::vector<std::string> formatted(group);
+
+			for(int first = 0; first < blocks; first += group) {
+				int last = std::min(first + group, blocks);
+				pool.parallelFor(first, last, [&] (int begin, int end) {
+					for(int block = begin; block < end; ++block) {
+						std::string& out = formatted[block - first];
+						out.clear();
+						formatRows(rows, block * BLOCK_ROWS, std::min(count, (block + 1) * BLOCK_ROWS),
+								columns, layout, out);
+					}
+				});
+
+				for(int block = first; block < last; ++block)
+					sink(formatted[block - first]);
+			}
+		}
+
+		/**
+		 * 	@brief	Parse one line of text into a row of values
+		 *
+		 * 	Whitespace around values is ignored, as is the trailing separator of the Pipe layout
+		 *
+		 * 	@param	std::string_view		Line, without its newline
+		 * 	@param	T*						Row to fill
+		 * 	@param	int						Number of values expected
+		 * 	@param	Layout					Layout of the line
+		 * 	@throws   std::invalid_argument	If a value can't be parsed
+		 * 	@throws   std::out_of_range		If the line doesn't have exactly columns values
+		 *
+		 * 	@version	0.1
+		 */
+		template <typename T>
+		void parseRow(std::string_view line, T* row, int columns, Layout layout) {
+			char delimiter = (layout == Layout::CSV) ? ',' : (layout == Layout::TSV ? '\t' : '|');
+			const char* position = line.data();
+			const char* end = line.data() + line.size();
+			int column = 0;
+
+			while(true) {
+				// Skip blanks before the value (tabs included, except as the TSV delimiter)
+				while(position < end && (*position == ' ' || *position == '\r' ||
+						(*position == '\t' && layout != Layout::TSV)))
+					++position;
+				if(position == end)
+					break;
+
+				if(column == columns)
+					throw std::out_of_range("Row has more values than the matrix has columns");
+				if(*position == '+')
+					++position;
+				auto [parsed, error] = std::from_chars(position, end, row[column]);
+				if(error != std::errc())
+					throw std::invalid_argument("Unable to parse value " + std::to_string(column) +
+							" of row: " + std::string(line));
+				++column;
+				position = parsed;
+
+				// Step over the blanks and the delimiter after the value
+				while(position < end && (*position == ' ' || *position == '\r' ||
+						(*position == '\t' && layout != Layout::TSV)))
+					++position;
+				if(position == end)
+					break;
+				if(*position != delimiter)
+					throw std::invalid_argument("Unexpected character in row: " + std::string(line));
+				++position;
+			}
+
+			if(column != columns)
+				throw std::out_of_range("Row has fewer values than the matrix has columns");
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,121 @@
+/**
+ *  @file		text_io.cpp
+ *  @brief	  Implement the template code for the matrix text I/O
+ *
+ * 	Details
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-19-2026
+ *  @version	0.1
+ */
+
+#include <iterator>
+#include <cerrno>
+#include <cstring>
+
+#include <unistd.h>
+
+#include "text_io.h"
+
+namespace matrix {
+	namespace text {
+		//
+		// format (const Matrix<M, N, T>&, Layout) -> std::string
+		//
+		template <int M, int N, typename T>
+		std::string format(const Matrix<M, N, T>& m, Layout layout) {
+			std::vector<const T*> rows(M);
+			for(int row = 0; row < M; ++row)
+				rows[row] = m[row].data();
+
+			std::string result;
+			formatBlocks(rows.data(), M, N, layout, [&result] (const std::string& block) {
+				result += block;
+			});
+
+			return result;
+		}
+
+		//
+		// write (const Matrix<M, N, T>&, std::ostream&, Layout) -> void
+		//
+		template <int M, int N, typename T>
+		void write(const Matrix<M, N, T>& m, std::ostream& out, Layout layout) {
+			std::vector<const T*> rows(M);
+			for(int row = 0; row < M; ++row)
+				rows[row] = m[row].data();
+
+			formatBlocks(rows.data(), M, N, layout, [&out] (const std::string& block) {
+				if(!out.write(block.data(), block.size()))
+					throw std::runtime_error("Unable to write matrix to stream");
+			});
+		}
+
+		//
+		// write (const Matrix<M, N, T>&, int, Layout) -> void
+		//
+		template <int M, int N, typename T>
+		void write(const Matrix<M, N, T>& m, int fd, Layout layout) {
+			std::vector<const T*> rows(M);
+			for(int row = 0; row < M; ++row)
+				rows[row] = m[row].data();
+
+			formatBlocks(rows.data(), M, N, layout, [fd] (const std::string& block) {
+				const char* position = block.data();
+				std::size_t remaining = block.size();
+				while(remaining > 0) {
+					ssize_t count = ::write(fd, position, remaining);
+					if(count < 0 && errno == EINTR)
+						continue;
+					if(count < 0)
+						throw std::runtime_error(std::string("Unable to write matrix: ") + std::strerror(errno));
+					position += count;
+					remaining -= count;
+				}
+			});
+		}
+
+		//
+		// parse (std::string_view, Layout) -> Matrix<M, N, T>
+		//
+		template <int M, int N, typename T>
+		Matrix<M, N, T> parse(std::string_view text, Layout layout) {
+			// Find the non-blank lines first, so the rows can be parsed in parallel
+			std::vector<std::string_view> lines;
+			lines.reserve(M);
+			std::size_t start = 0;
+			while(start < text.size()) {
+				std::size_t end = text.find('\n', start);
+				if(end == std::string_view::npos)
+					end = text.size();
+
+				std::string_view line = text.substr(start, end - start);
+				if(line.find_first_not_of(" \t\r") != std::string_view::npos) {
+					if(lines.size() == static_cast<std::size_t>(M))
+						throw std::out_of_range("Text has more rows than the matrix");
+					lines.push_back(line);
+				}
+				start = end + 1;
+			}
+			if(lines.size() != static_cast<std::size_t>(M))
+				throw std::out_of_range("Text has fewer rows than the matrix");
+
+			Matrix<M, N, T> result;
+			kernels::forRows(M, N, [&] (int begin, int end) {
+				for(int row = begin; row < end; ++row)
+					parseRow(lines[row], result[row].data(), N, layout);
+			});
+
+			return result;
+		}
+
+		//
+		// read (std::istream&, Layout) -> Matrix<M, N, T>
+		//
+		template <int M, int N, typename T>
+		Matrix<M, N, T> read(std::istream& in, Layout layout) {
+			std::string text((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+			return parse<M, N, T>(text, layout);
+		}
+	}
+}
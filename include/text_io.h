@@ -0,0 +1,83 @@
+/**
+ *  @file		text_io.h
+ *  @brief	  Define reading and writing matrices as CSV, TSV, or the pipe layout of the string form
+ *
+ * 	Large matrices are formatted and parsed in parallel by blocks of rows,
+ * 	and written straight to a stream or file descriptor a group of blocks at a time.
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-19-2026
+ *  @version	0.1
+ */
+
+#ifndef TEXT_IO_H
+#define TEXT_IO_H
+
+#include <string>
+#include <string_view>
+#include <ostream>
+#include <istream>
+
+#include "matrix/matrix.h"
+#include "matrix/text_format.h"
+
+namespace matrix {
+	namespace text {
+
+		/**
+		 * 	@brief	Format a matrix as text
+		 *
+		 * 	@param	const Matrix<M, N, T>&		Matrix to format
+		 * 	@param	Layout							Layout to write
+		 * 	@return	  std::string					Matrix as text
+		 *
+		 * 	@version	0.1
+		 */
+		template <int M, int N, typename T>
+		std::string format(const Matrix<M, N, T>& m, Layout layout = Layout::Pipe);
+
+		/**
+		 * 	@brief	Write a matrix as text to a stream
+		 *
+		 * 	@throws   std::runtime_error		If the stream fails
+		 *
+		 * 	@version	0.1
+		 */
+		template <int M, int N, typename T>
+		void write(const Matrix<M, N, T>& m, std::ostream& out, Layout layout = Layout::Pipe);
+
+		/**
+		 * 	@brief	Write a matrix as text to a file descriptor
+		 *
+		 * 	@throws   std::runtime_error		If a write fails
+		 *
+		 * 	@version	0.1
+		 */
+		template <int M, int N, typename T>
+		void write(const Matrix<M, N, T>& m, int fd, Layout layout = Layout::Pipe);
+
+		/**
+		 * 	@brief	Parse a matrix from text, one row per line
+		 *
+		 * 	Blank lines are skipped
+		 *
+		 * 	@param	std::string_view		Text to parse
+		 * 	@param	Layout					Layout of the text
+		 * 	@return	  Matrix<M, N, T>		Matrix read
+		 * 	@throws   std::invalid_argument	If a value can't be parsed
+		 * 	@throws   std::out_of_range		If the text isn't M x N values
+		 *
+		 * 	@version	0.1
+		 */
+		template <int M, int N, typename T>
+		Matrix<M, N, T> parse(std::string_view text, Layout layout = Layout::Pipe);
+
+		/// Read the rest of a stream and parse it as a matrix
+		template <int M, int N, typename T>
+		Matrix<M, N, T> read(std::istream& in, Layout layout = Layout::Pipe);
+	}
+}
+
+#include "matrix/text_io.cpp"
+
+#endif
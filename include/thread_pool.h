@@ -0,0 +1,349 @@
+/**
+ *  @file		thread_pool.h
+ *  @brief	  Define the pool of worker threads shared by the matrix library
+ *
+ * 	Asynchronous operations and the parallel kernels all run their work on
+ * 	the one pool returned by ThreadPool::getInstance()
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-19-2026
+ *  @version	0.2
+ */
+
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <vector>
+#include <deque>
+#include <chrono>
+#include <memory>
+#include <future>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <algorithm>
+#include <atomic>
+#include <exception>
+
+namespace matrix {
+
+	/**
+	 * 	@class		ThreadPool
+	 * 	@brief		Fixed set of worker threads pulling jobs from a shared queue
+	 *
+	 * 	Jobs submitted from inside a worker are still queued.  parallelFor() called
+	 * 	from a worker shares its chunks with whichever workers are idle and runs
+	 * 	the rest itself, so nested kernels still fan out but never deadlock
+	 * 	waiting on the workers they occupy
+	 *
+	 * 	Workers can be pinned to CPUs, ordered by NUMA node (through libnuma when
+	 * 	it was found at build time), so chunk i of every parallelFor() over the
+	 * 	same range runs on the same core.  Memory first touched by a chunk then
+	 * 	stays local to the node of the worker that later computes on it.
+	 *
+	 * 	Placement is only a preference: a job queued for a worker that hasn't
+	 * 	started it within the pool's steal delay, say because it is running a long task,
+	 * 	is taken by an idle worker or by the thread waiting in parallelFor()
+	 *
+	 */
+	class ThreadPool {
+		public:
+			/// Default wait of a job queued for one worker before others may take it
+			static constexpr std::chrono::microseconds DEFAULT_STEAL_AFTER{1000};
+
+			/**
+			 * 	@brief	Construct a pool with the number of threads provided
+			 *
+			 * 	A count of 0 uses one thread per CPU the process may run on.
+			 * 	Pinning quietly does nothing where the platform doesn't allow it.
+			 *
+			 * 	@param	unsigned int				Number of worker threads
+			 * 	@param	bool						Pin each worker to its own CPU
+			 * 	@param	std::chrono::microseconds	How long a job queued for one worker
+			 * 										waits before others may take it
+			 *
+			 * 	@version	0.3
+			 */
+			explicit ThreadPool(unsigned int numThreads = 0, bool pinned = false,
+					std::chrono::microseconds stealAfter = DEFAULT_STEAL_AFTER);
+
+			ThreadPool(const ThreadPool& copy) = delete;
+			ThreadPool& operator = (const ThreadPool& rhs) = delete;
+
+			/**
+			 * 	@brief	Get the pool shared by the whole library
+			 *
+			 * 	Workers are pinned unless the MATRIX_PIN_THREADS environment variable is 0.
+			 * 	The pool is built on first use in each process: a child forked after
+			 * 	it started never touches the parent's copy, whose threads it doesn't
+			 * 	have, and builds its own instead.
+			 *
+			 * 	@version	0.3
+			 */
+			static ThreadPool& getInstance();
+
+			/**
+			 * 	@brief	Choose how getInstance() builds the pool of this process
+			 *
+			 * 	Has no effect once the pool exists, so call it before the first kernel,
+			 * 	or in a freshly forked child
+			 *
+			 * 	@param	unsigned int		Number of worker threads, 0 for one per CPU
+			 * 	@param	bool				Pin each worker to its own CPU
+			 * 	@return	  bool			If the pool will be built that way
+			 *
+			 * 	@version	0.1
+			 */
+			static bool configureInstance(unsigned int numThreads, bool pinned);
+
+			/// Check if the calling thread is a worker of any ThreadPool
+			static bool isWorkerThread();
+
+			/**
+			 * 	@brief	Queue a job without any way to wait on it
+			 *
+			 * 	@param	std::function<void()>		Job to run on a worker
+			 *
+			 * 	@version	0.1
+			 */
+			void post(std::function<void()> job);
+
+			/**
+			 * 	@brief	Queue a job for one specific worker
+			 *
+			 * 	Another worker may run it if it has waited longer than getStealAfter()
+			 *
+			 * 	@param	unsigned int				Index of the worker, wrapped to size()
+			 * 	@param	std::function<void()>		Job to run on that worker
+			 *
+			 * 	@version	0.2
+			 */
+			void postTo(unsigned int worker, std::function<void()> job);
+
+			/**
+			 * 	@brief	Queue a callable and return a future to its result
+			 *
+			 * 	Exceptions thrown by the callable are stored in the future
+			 *
+			 * 	@param	Function&&							Callable taking no arguments
+			 * 	@return	  std::future<result of Function>	Future to the result
+			 *
+			 * 	@version	0.1
+			 */
+			template <typename Function>
+			auto submit(Function&& function) -> std::future<decltype(function())> {
+				using Result = decltype(function());
+				auto task = std::make_shared<std::packaged_task<Result()>>(
+						std::forward<Function>(function));
+				std::future<Result> future = task->get_future();
+				this->post([task] () { (*task)(); });
+				return future;
+			}
+
+			/// Queue a callable on one specific worker and return a future to its result
+			template <typename Function>
+			auto submitTo(unsigned int worker, Function&& function) -> std::future<decltype(function())> {
+				using Result = decltype(function());
+				auto task = std::make_shared<std::packaged_task<Result()>>(
+						std::forward<Function>(function));
+				std::future<Result> future = task->get_future();
+				this->postTo(worker, [task] () { (*task)(); });
+				return future;
+			}
+
+			/**
+			 * 	@brief	Split [begin, end) into one chunk per worker and wait for them
+			 *
+			 * 	Function is called as function(chunkBegin, chunkEnd), chunk i is queued
+			 * 	for worker i, so the same range is placed the same way while the pool is
+			 * 	idle.  Chunks left waiting on a busy worker are run by another worker or
+			 * 	by the calling thread.
+			 * 	Called from a worker, chunks go to whichever workers are free and the
+			 * 	calling worker runs whatever is left.
+			 * 	Runs inline when the range is smaller than grain
+			 *
+			 * 	@param	int				First index of the range
+			 * 	@param	int				One past the last index of the range
+			 * 	@param	Function		Operation applied to each chunk
+			 * 	@param	int				Smallest range worth splitting
+			 *
+			 * 	@version	0.2
+			 */
+			template <typename Function>
+			void parallelFor(int begin, int end, Function function, int grain = 1) {
+				int length = end - begin;
+				int chunks = std::min<int>(static_cast<int>(this->size()), length / std::max(grain, 1));
+				if(length <= 0)
+					return;
+				if(chunks <= 1) {
+					function(begin, end);
+					return;
+				}
+				if(ThreadPool::isWorkerThread()) {
+					this->shareChunks(begin, length, chunks, function);
+					return;
+				}
+
+				// Hand each worker one contiguous chunk, then wait for all of them
+				std::vector<std::future<void>> pending;
+				for(int chunk = 0; chunk < chunks; ++chunk) {
+					int chunkBegin = begin + static_cast<int>(static_cast<long long>(length) * chunk / chunks);
+					int chunkEnd = begin + static_cast<int>(static_cast<long long>(length) * (chunk + 1) / chunks);
+					pending.push_back(this->submitTo(chunk, [=, &function] () {
+						function(chunkBegin, chunkEnd);
+					}));
+				}
+				// Help with chunks stuck behind a busy worker while waiting
+				for(auto& future : pending) {
+					while(future.wait_for(this->stealAfter) != std::future_status::ready) {
+						while(this->runOverdue()) { }
+					}
+				}
+				for(auto& future : pending)
+					future.get();
+			}
+
+			/// Get the index of the worker running the calling thread, or -1 off the workers
+			static int currentWorker();
+
+			/// Get the number of worker threads
+			inline unsigned int size() const { return this->workers.size(); }
+
+			/// Get the CPU a worker is pinned to, or -1 if it isn't pinned
+			inline int getWorkerCpu(unsigned int worker) const { return this->cpus.at(worker); }
+
+			/// Get the NUMA node of a worker's CPU, or -1 if unknown
+			inline int getWorkerNode(unsigned int worker) const { return this->nodes.at(worker); }
+
+			/// Get how long a job queued for one worker waits before others may take it
+			inline std::chrono::microseconds getStealAfter() const { return this->stealAfter; }
+
+			/**
+			 * 	@brief	Destructor
+			 *
+			 * 	Finishes the queued jobs then joins the workers
+			 *
+			 * 	@version	0.1
+			 */
+			~ThreadPool();
+
+		private:
+			/// Threads running workerLoop()
+			std::vector<std::thread> workers;
+
+			/// CPU each worker is pinned to, -1 when not pinned
+			std::vector<int> cpus;
+
+			/// NUMA node of each worker, -1 when unknown
+			std::vector<int> nodes;
+
+			/// Jobs waiting for any worker
+			std::deque<std::function<void()>> jobs;
+
+			using Clock = std::chrono::steady_clock;
+
+			/// Jobs queued for one worker, and how to wake it
+			struct WorkerQueue {
+				/// Jobs with the time they were queued
+				std::deque<std::pair<Clock::time_point, std::function<void()>>> jobs;
+
+				/// Signalled when the worker has something to do
+				std::condition_variable wake;
+
+				/// Running a job
+				bool busy = false;
+
+				/// Waiting on wake
+				bool sleeping = false;
+			};
+
+			/// Queue of each worker
+			std::vector<std::unique_ptr<WorkerQueue>> queues;
+
+			/// Guards jobs, queues and stopping
+			std::mutex mutex;
+
+			/// Set by the destructor to release the workers
+			bool stopping;
+
+			/// How long a job queued for one worker waits before others may take it
+			std::chrono::microseconds stealAfter;
+
+			/// Choose the CPU and node of each worker, ordered by node
+			void placeWorkers(unsigned int numThreads, bool pinned);
+
+			/// Pull jobs from the queues until the pool stops
+			void workerLoop(unsigned int worker);
+
+			/// Wake one sleeping worker other than skip, call with mutex held
+			void wakeOne(int skip);
+
+			/**
+			 * 	@brief	Take the next job for a worker, call with mutex held
+			 *
+			 * 	Its own jobs come first, then shared jobs, then jobs that have waited
+			 * 	stealAfter on other workers.  A worker of -1 only takes those last.
+			 *
+			 * 	@param	int						Worker taking the job, or -1
+			 * 	@param	Clock::time_point&		Set to when the next job of another
+			 * 										worker may be taken, if there is one
+			 * 	@return	  std::function<void()>	Job, empty if there is none
+			 */
+			std::function<void()> takeJob(int worker, Clock::time_point& nextSteal);
+
+			/// Run one job that has waited too long for its worker, return if there was one
+			bool runOverdue();
+
+			/**
+			 * 	@brief	Run the chunks of a parallelFor() called from a worker
+			 *
+			 * 	Helpers queued for the other workers and the calling worker claim
+			 * 	chunks from a shared counter.  The caller can run every chunk itself,
+			 * 	so it never waits on a helper that hasn't started.
+			 */
+			template <typename Function>
+			void shareChunks(int begin, int length, int chunks, Function& function) {
+				struct Shared {
+					std::atomic<int> next{0};
+					std::mutex mutex;
+					std::condition_variable done;
+					int finished = 0;
+					std::exception_ptr error;
+				};
+				auto shared = std::make_shared<Shared>();
+
+				// Helpers that start after the last chunk was claimed never touch function
+				auto work = [shared, begin, length, chunks, &function] () {
+					for(int chunk = shared->next++; chunk < chunks; chunk = shared->next++) {
+						int chunkBegin = begin + static_cast<int>(static_cast<long long>(length) * chunk / chunks);
+						int chunkEnd = begin + static_cast<int>(static_cast<long long>(length) * (chunk + 1) / chunks);
+						std::exception_ptr error;
+						try {
+							function(chunkBegin, chunkEnd);
+						}
+						catch(...) {
+							error = std::current_exception();
+						}
+
+						std::lock_guard<std::mutex> lock(shared->mutex);
+						if(error && !shared->error)
+							shared->error = error;
+						if(++shared->finished == chunks)
+							shared->done.notify_all();
+					}
+				};
+				for(int helper = 1; helper < chunks; ++helper)
+					this->post(work);
+				work();
+
+				// Wait for chunks still running on the helpers
+				std::unique_lock<std::mutex> lock(shared->mutex);
+				shared->done.wait(lock, [&shared, chunks] () { return shared->finished == chunks; });
+				if(shared->error)
+					std::rethrow_exception(shared->error);
+			}
+	};
+}
+
+#endif
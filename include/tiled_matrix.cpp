@@ -0,0 +1,510 @@
+/**
+ *  @file		tiled_matrix.cpp
+ *  @brief	  Implement the template code for the disk-backed tiled matrix
+ *
+ * 	Details
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-19-2026
+ *  @version	0.1
+ */
+
+#include <vector>
+#include <stdexcept>
+#include <cerrno>
+#include <cstring>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/types.h>
+
+#include "tiled_matrix.h"
+
+namespace matrix {
+	//
+	// Constructor
+	//
+	template <int M, int N, typename T, int B>
+	TiledMatrix<M, N, T, B>::TiledMatrix(const std::string& path, std::size_t cacheTiles) :
+			path(path),
+			file(std::make_shared<File>()),
+			capacity(std::max<std::size_t>(cacheTiles, 1)) {
+		this->file->fd = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+		if(this->file->fd < 0)
+			throw std::runtime_error("Unable to open " + path + ": " + std::strerror(errno));
+
+		// Size the file for every tile, new space reads back as zero bytes
+		off_t bytes = static_cast<off_t>(TILE_ROWS) * TILE_COLUMNS * B * B * sizeof(T);
+		if(::ftruncate(this->file->fd, bytes) != 0)
+			throw std::runtime_error("Unable to size " + path + ": " + std::strerror(errno));
+	}
+
+	//
+	// readTile (int, int) -> std::shared_ptr<const Tile>
+	//
+	template <int M, int N, typename T, int B>
+	std::shared_ptr<const typename TiledMatrix<M, N, T, B>::Tile>
+			TiledMatrix<M, N, T, B>::readTile(int tileRow, int tileColumn) {
+		long index = this->tileIndex(tileRow, tileColumn);
+
+		std::shared_ptr<Load> load;
+		{
+			std::lock_guard<std::mutex> lock(this->mutex);
+			load = this->fetch(index);
+
+			// The caller keeps the tile, so set() has to copy it before changing it again
+			this->cache[index].writable = nullptr;
+		}
+
+		return this->await(index, load);
+	}
+
+	//
+	// writeTile (int, int, Tile) -> void
+	//
+	template <int M, int N, typename T, int B>
+	void TiledMatrix<M, N, T, B>::writeTile(int tileRow, int tileColumn, Tile tile) {
+		long index = this->tileIndex(tileRow, tileColumn);
+
+		// Keep the padding past the edge of the matrix at T()
+		int rows = std::min(B, M - tileRow * B);
+		int columns = std::min(B, N - tileColumn * B);
+		for(int row = 0; row < B; ++row) {
+			for(int column = (row < rows ? columns : 0); column < B; ++column)
+				tile[row][column] = T();
+		}
+
+		// Store it as a load that has already completed
+		auto writable = std::make_shared<Tile>(std::move(tile));
+		auto load = TiledMatrix::loaded(writable);
+
+		std::lock_guard<std::mutex> lock(this->mutex);
+		auto found = this->cache.find(index);
+		if(found != this->cache.end()) {
+			found->second.load = std::move(load);
+			found->second.dirty = true;
+			found->second.writable = std::move(writable);
+			this->recent.splice(this->recent.begin(), this->recent, found->second.position);
+			return;
+		}
+
+		this->makeRoom();
+		this->recent.push_front(index);
+		this->cache[index] = Entry { std::move(load), true, this->recent.begin(), std::move(writable) };
+	}
+
+	//
+	// prefetch (int, int) -> void
+	//
+	template <int M, int N, typename T, int B>
+	void TiledMatrix<M, N, T, B>::prefetch(int tileRow, int tileColumn) {
+		if(tileRow < 0 || tileRow >= TILE_ROWS || tileColumn < 0 || tileColumn >= TILE_COLUMNS)
+			return;
+		long index = this->tileIndex(tileRow, tileColumn);
+
+		std::shared_ptr<Load> load;
+		{
+			std::lock_guard<std::mutex> lock(this->mutex);
+			if(this->cache.count(index))
+				return;
+			load = this->fetch(index);
+		}
+
+		// A reader that gets there first runs the load itself
+		ThreadPool::getInstance().post([load] () {
+			if(!load->claimed.exchange(true))
+				load->task();
+		});
+	}
+
+	//
+	// get (int, int) -> T
+	//
+	template <int M, int N, typename T, int B>
+	T TiledMatrix<M, N, T, B>::get(int row, int column) {
+		if(row < 0 || row >= M || column < 0 || column >= N)
+			throw std::out_of_range("Index must be within the matrix");
+
+		long index = this->tileIndex(row / B, column / B);
+
+		std::shared_ptr<Load> load;
+		{
+			// A writable tile may be changing, so it is only read under the lock
+			std::lock_guard<std::mutex> lock(this->mutex);
+			auto found = this->cache.find(index);
+			if(found != this->cache.end() && found->second.writable) {
+				this->recent.splice(this->recent.begin(), this->recent, found->second.position);
+				return (*found->second.writable)[row % B][column % B];
+			}
+			load = this->fetch(index);
+		}
+
+		return (*this->await(index, load))[row % B][column % B];
+	}
+
+	//
+	// set (int, int, const T&) -> void
+	//
+	template <int M, int N, typename T, int B>
+	void TiledMatrix<M, N, T, B>::set(int row, int column, const T& value) {
+		if(row < 0 || row >= M || column < 0 || column >= N)
+			throw std::out_of_range("Index must be within the matrix");
+
+		long index = this->tileIndex(row / B, column / B);
+
+		std::unique_lock<std::mutex> lock(this->mutex);
+		Entry& entry = this->writableEntry(index, lock);
+		(*entry.writable)[row % B][column % B] = value;
+		entry.dirty = true;
+	}
+
+	//
+	// flush () -> void
+	//
+	template <int M, int N, typename T, int B>
+	void TiledMatrix<M, N, T, B>::flush() {
+		std::lock_guard<std::mutex> lock(this->mutex);
+
+		for(auto& cached : this->cache) {
+			if(!cached.second.dirty)
+				continue;
+			TiledMatrix::writeToDisk(*this->file, cached.first, *TiledMatrix::complete(cached.second.load));
+			cached.second.dirty = false;
+		}
+	}
+
+	//
+	// tileIndex (int, int) -> long
+	//
+	template <int M, int N, typename T, int B>
+	long TiledMatrix<M, N, T, B>::tileIndex(int tileRow, int tileColumn) const {
+		if(tileRow < 0 || tileRow >= TILE_ROWS || tileColumn < 0 || tileColumn >= TILE_COLUMNS)
+			throw std::out_of_range("Tile index must be within the tiles of the matrix");
+
+		return static_cast<long>(tileRow) * TILE_COLUMNS + tileColumn;
+	}
+
+	//
+	// fetch (long) -> std::shared_ptr<Load>
+	//
+	template <int M, int N, typename T, int B>
+	std::shared_ptr<typename TiledMatrix<M, N, T, B>::Load>
+			TiledMatrix<M, N, T, B>::fetch(long index) {
+		auto found = this->cache.find(index);
+		if(found != this->cache.end()) {
+			this->recent.splice(this->recent.begin(), this->recent, found->second.position);
+			return found->second.load;
+		}
+
+		// Create a load that hasn't been started, the file stays open until it runs
+		auto load = std::make_shared<Load>();
+		load->claimed = false;
+		load->task = std::packaged_task<std::shared_ptr<const Tile>()>(
+				[file = this->file, index] () {
+			return TiledMatrix::readFromDisk(*file, index);
+		});
+		load->tile = load->task.get_future().share();
+
+		this->makeRoom();
+		this->recent.push_front(index);
+		this->cache[index] = Entry { load, false, this->recent.begin(), nullptr };
+		return load;
+	}
+
+	//
+	// makeRoom () -> void
+	//
+	template <int M, int N, typename T, int B>
+	void TiledMatrix<M, N, T, B>::makeRoom() {
+		while(this->cache.size() >= this->capacity && !this->recent.empty()) {
+			long victim = this->recent.back();
+			Entry& entry = this->cache[victim];
+
+			// Modified tiles have always completed, so this never waits on a read
+			if(entry.dirty)
+				TiledMatrix::writeToDisk(*this->file, victim, *TiledMatrix::complete(entry.load));
+
+			this->recent.pop_back();
+			this->cache.erase(victim);
+		}
+	}
+
+	//
+	// writableEntry (long, std::unique_lock<std::mutex>&) -> Entry&
+	//
+	template <int M, int N, typename T, int B>
+	typename TiledMatrix<M, N, T, B>::Entry&
+			TiledMatrix<M, N, T, B>::writableEntry(long index, std::unique_lock<std::mutex>& lock) {
+		while(true) {
+			std::shared_ptr<Load> load = this->fetch(index);
+			Entry& entry = this->cache[index];
+			if(entry.writable)
+				return entry;
+
+			// Read and copy the tile without holding up other tiles
+			lock.unlock();
+			auto writable = std::make_shared<Tile>(*this->await(index, load));
+			lock.lock();
+
+			// Start over if the tile was evicted or replaced in the meantime
+			auto found = this->cache.find(index);
+			if(found == this->cache.end() || found->second.load != load)
+				continue;
+			found->second.load = TiledMatrix::loaded(writable);
+			found->second.writable = std::move(writable);
+			return found->second;
+		}
+	}
+
+	//
+	// loaded (std::shared_ptr<const Tile>) -> std::shared_ptr<Load>
+	//
+	template <int M, int N, typename T, int B>
+	std::shared_ptr<typename TiledMatrix<M, N, T, B>::Load>
+			TiledMatrix<M, N, T, B>::loaded(std::shared_ptr<const Tile> tile) {
+		auto load = std::make_shared<Load>();
+		load->claimed = true;
+		std::promise<std::shared_ptr<const Tile>> ready;
+		ready.set_value(std::move(tile));
+		load->tile = ready.get_future().share();
+		return load;
+	}
+
+	//
+	// readFromDisk (const File&, long) -> std::shared_ptr<const Tile>
+	//
+	template <int M, int N, typename T, int B>
+	std::shared_ptr<const typename TiledMatrix<M, N, T, B>::Tile>
+			TiledMatrix<M, N, T, B>::readFromDisk(const File& file, long index) {
+		// Read the whole tile with as few calls as possible
+		std::vector<T> buffer(static_cast<std::size_t>(B) * B);
+		char* bytes = reinterpret_cast<char*>(buffer.data());
+		std::size_t remaining = buffer.size() * sizeof(T);
+		off_t offset = static_cast<off_t>(index) * B * B * sizeof(T);
+		while(remaining > 0) {
+			ssize_t count = ::pread(file.fd, bytes, remaining, offset);
+			if(count < 0 && errno == EINTR)
+				continue;
+			if(count <= 0)
+				throw std::runtime_error(std::string("Unable to read tile: ") + std::strerror(errno));
+			bytes += count;
+			remaining -= count;
+			offset += count;
+		}
+
+		auto tile = std::make_shared<Tile>();
+		for(int row = 0; row < B; ++row)
+			std::copy(buffer.begin() + row * B, buffer.begin() + (row + 1) * B, (*tile)[row].begin());
+
+		return tile;
+	}
+
+	//
+	// writeToDisk (const File&, long, const Tile&) -> void
+	//
+	template <int M, int N, typename T, int B>
+	void TiledMatrix<M, N, T, B>::writeToDisk(const File& file, long index, const Tile& tile) {
+		std::vector<T> buffer(static_cast<std::size_t>(B) * B);
+		for(int row = 0; row < B; ++row)
+			std::copy(tile[row].begin(), tile[row].end(), buffer.begin() + row * B);
+
+		const char* bytes = reinterpret_cast<const char*>(buffer.data());
+		std::size_t remaining = buffer.size() * sizeof(T);
+		off_t offset = static_cast<off_t>(index) * B * B * sizeof(T);
+		while(remaining > 0) {
+			ssize_t count = ::pwrite(file.fd, bytes, remaining, offset);
+			if(count < 0 && errno == EINTR)
+				continue;
+			if(count <= 0)
+				throw std::runtime_error(std::string("Unable to write tile: ") + std::strerror(errno));
+			bytes += count;
+			remaining -= count;
+			offset += count;
+		}
+	}
+
+	//
+	// complete (const std::shared_ptr<Load>&) -> std::shared_ptr<const Tile>
+	//
+	template <int M, int N, typename T, int B>
+	std::shared_ptr<const typename TiledMatrix<M, N, T, B>::Tile>
+			TiledMatrix<M, N, T, B>::complete(const std::shared_ptr<Load>& load) {
+		if(!load->claimed.exchange(true))
+			load->task();
+
+		return load->tile.get();
+	}
+
+	//
+	// await (long, const std::shared_ptr<Load>&) -> std::shared_ptr<const Tile>
+	//
+	template <int M, int N, typename T, int B>
+	std::shared_ptr<const typename TiledMatrix<M, N, T, B>::Tile>
+			TiledMatrix<M, N, T, B>::await(long index, const std::shared_ptr<Load>& load) {
+		try {
+			return TiledMatrix::complete(load);
+		}
+		catch(...) {
+			// Leave the entry alone if it has been replaced since
+			std::lock_guard<std::mutex> lock(this->mutex);
+			auto found = this->cache.find(index);
+			if(found != this->cache.end() && found->second.load == load) {
+				this->recent.erase(found->second.position);
+				this->cache.erase(found);
+			}
+			throw;
+		}
+	}
+
+	//
+	// File Destructor
+	//
+	template <int M, int N, typename T, int B>
+	TiledMatrix<M, N, T, B>::File::~File() {
+		if(this->fd >= 0)
+			::close(this->fd);
+	}
+
+	//
+	// Destructor
+	//
+	template <int M, int N, typename T, int B>
+	TiledMatrix<M, N, T, B>::~TiledMatrix() {
+		try {
+			this->flush();
+		}
+		catch(...) {
+			// Nowhere to report it, callers that care call flush() first
+		}
+	}
+
+	//
+	// multiply (TiledMatrix<M, N, T, B>&, TiledMatrix<N, R, T, B>&, TiledMatrix<M, R, T, B>&) -> void
+	//
+	template <int M, int N, int R, typename T, int B>
+	void multiply(TiledMatrix<M, N, T, B>& lhs, TiledMatrix<N, R, T, B>& rhs,
+			TiledMatrix<M, R, T, B>& result) {
+		constexpr int ROWS = TiledMatrix<M, R, T, B>::TILE_ROWS;
+		constexpr int COLUMNS = TiledMatrix<M, R, T, B>::TILE_COLUMNS;
+		constexpr int INNER = TiledMatrix<M, N, T, B>::TILE_COLUMNS;
+
+		std::vector<const T*> leftRows(B), rightRows(B);
+		std::vector<T*> accumulatedRows(B);
+
+		for(int row = 0; row < ROWS; ++row) {
+			for(int column = 0; column < COLUMNS; ++column) {
+				auto accumulated = Matrix<B, B, T>(T());
+				for(int i = 0; i < B; ++i)
+					accumulatedRows[i] = accumulated[i].data();
+
+				for(int k = 0; k < INNER; ++k) {
+					// Prefetch the pair needed next, which may start the next output tile
+					if(k + 1 < INNER) {
+						lhs.prefetch(row, k + 1);
+						rhs.prefetch(k + 1, column);
+					}
+					else if(column + 1 < COLUMNS)
+						rhs.prefetch(0, column + 1);
+					else {
+						lhs.prefetch(row + 1, 0);
+						rhs.prefetch(0, 0);
+					}
+
+					// Sum straight into the output tile, without a product tile per step
+					auto left = lhs.readTile(row, k);
+					auto right = rhs.readTile(k, column);
+					for(int i = 0; i < B; ++i) {
+						leftRows[i] = (*left)[i].data();
+						rightRows[i] = (*right)[i].data();
+					}
+					kernels::parallelGemm<T>(leftRows.data(), rightRows.data(), accumulatedRows.data(), B, B, B);
+				}
+
+				result.writeTile(row, column, std::move(accumulated));
+			}
+		}
+	}
+
+	//
+	// transpose (TiledMatrix<M, N, T, B>&, TiledMatrix<N, M, T, B>&) -> void
+	//
+	template <int M, int N, typename T, int B>
+	void transpose(TiledMatrix<M, N, T, B>& source, TiledMatrix<N, M, T, B>& result) {
+		constexpr int ROWS = TiledMatrix<M, N, T, B>::TILE_ROWS;
+		constexpr int COLUMNS = TiledMatrix<M, N, T, B>::TILE_COLUMNS;
+
+		for(int row = 0; row < ROWS; ++row) {
+			for(int column = 0; column < COLUMNS; ++column) {
+				if(column + 1 < COLUMNS)
+					source.prefetch(row, column + 1);
+				else
+					source.prefetch(row + 1, 0);
+
+				result.writeTile(column, row, source.readTile(row, column)->transpose());
+			}
+		}
+	}
+
+	//
+	// forEachTile (TiledMatrix<M, N, T, B>&, TiledMatrix<M, N, T, B>&, Operation) -> void
+	//
+	template <int M, int N, typename T, int B, typename Operation>
+	void forEachTile(TiledMatrix<M, N, T, B>& source, TiledMatrix<M, N, T, B>& result,
+			Operation operation) {
+		constexpr int ROWS = TiledMatrix<M, N, T, B>::TILE_ROWS;
+		constexpr int COLUMNS = TiledMatrix<M, N, T, B>::TILE_COLUMNS;
+
+		// Walk the tiles in file order, applying the operation to each
+		for(int row = 0; row < ROWS; ++row) {
+			for(int column = 0; column < COLUMNS; ++column) {
+				int nextRow = (column + 1 < COLUMNS) ? row : row + 1;
+				int nextColumn = (column + 1 < COLUMNS) ? column + 1 : 0;
+
+				Matrix<B, B, T> tile = *source.readTile(row, column);
+				operation(row, column, nextRow, nextColumn, tile);
+				result.writeTile(row, column, std::move(tile));
+			}
+		}
+	}
+
+	//
+	// add (TiledMatrix<M, N, T, B>&, TiledMatrix<M, N, T, B>&, TiledMatrix<M, N, T, B>&) -> void
+	//
+	template <int M, int N, typename T, int B>
+	void add(TiledMatrix<M, N, T, B>& lhs, TiledMatrix<M, N, T, B>& rhs,
+			TiledMatrix<M, N, T, B>& result) {
+		forEachTile(lhs, result, [&] (int row, int column, int nextRow, int nextColumn,
+				Matrix<B, B, T>& tile) {
+			lhs.prefetch(nextRow, nextColumn);
+			rhs.prefetch(nextRow, nextColumn);
+			tile += *rhs.readTile(row, column);
+		});
+	}
+
+	//
+	// subtract (TiledMatrix<M, N, T, B>&, TiledMatrix<M, N, T, B>&, TiledMatrix<M, N, T, B>&) -> void
+	//
+	template <int M, int N, typename T, int B>
+	void subtract(TiledMatrix<M, N, T, B>& lhs, TiledMatrix<M, N, T, B>& rhs,
+			TiledMatrix<M, N, T, B>& result) {
+		forEachTile(lhs, result, [&] (int row, int column, int nextRow, int nextColumn,
+				Matrix<B, B, T>& tile) {
+			lhs.prefetch(nextRow, nextColumn);
+			rhs.prefetch(nextRow, nextColumn);
+			tile -= *rhs.readTile(row, column);
+		});
+	}
+
+	//
+	// scale (TiledMatrix<M, N, T, B>&, const T&, TiledMatrix<M, N, T, B>&) -> void
+	//
+	template <int M, int N, typename T, int B>
+	void scale(TiledMatrix<M, N, T, B>& source, const T& scalar,
+			TiledMatrix<M, N, T, B>& result) {
+		forEachTile(source, result, [&] (int, int, int nextRow, int nextColumn,
+				Matrix<B, B, T>& tile) {
+			source.prefetch(nextRow, nextColumn);
+			tile *= scalar;
+		});
+	}
+}
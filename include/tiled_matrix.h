@@ -0,0 +1,262 @@
+/**
+ *  @file		tiled_matrix.h
+ *  @brief	  Define a disk-backed matrix stored as square tiles in a file
+ *
+ * 	For matrices larger than memory.  Tiles are paged in with explicit reads
+ * 	into an LRU cache, and the streaming operations prefetch the next tiles on
+ * 	the ThreadPool while the current ones are being computed.  Every tile is a
+ * 	Matrix<B, B, T>, so the in-memory operators do the work on each tile.
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-19-2026
+ *  @version	0.1
+ */
+
+#ifndef TILED_MATRIX_H
+#define TILED_MATRIX_H
+
+#include <string>
+#include <memory>
+#include <list>
+#include <unordered_map>
+#include <mutex>
+#include <atomic>
+#include <future>
+#include <type_traits>
+
+#include "matrix/matrix.h"
+#include "matrix/thread_pool.h"
+
+namespace matrix {
+
+	/**
+	 * 	@class		TiledMatrix
+	 * 	@brief		M x N matrix of T stored on disk as B x B tiles
+	 *
+	 * 	Tiles on the right and bottom edges are padded out to B x B, the padding
+	 * 	is kept at T() so that it never contributes to a product.
+	 * 	T must be trivially copyable since tiles are stored as raw bytes.
+	 * 	Reading and writing tiles is thread safe.
+	 *
+	 */
+	template <int M, int N, typename T = double, int B = 256>
+	class TiledMatrix {
+		static_assert(std::is_trivially_copyable<T>::value,
+				"TiledMatrix stores tiles as raw bytes, T must be trivially copyable");
+
+		public:
+			/// In-memory type of a single tile
+			using Tile = Matrix<B, B, T>;
+
+			/// Number of rows of tiles
+			static constexpr int TILE_ROWS = (M + B - 1) / B;
+
+			/// Number of columns of tiles
+			static constexpr int TILE_COLUMNS = (N + B - 1) / B;
+
+			/**
+			 * 	@brief	Open (or create) the backing file for the matrix
+			 *
+			 * 	A new file is sized to hold every tile, and reads back as T()
+			 *
+			 * 	@param	const std::string&		Path of the backing file
+			 * 	@param	std::size_t				Number of tiles kept in memory
+			 * 	@throws   std::runtime_error		If the file can't be opened or sized
+			 *
+			 * 	@version	0.1
+			 */
+			explicit TiledMatrix(const std::string& path, std::size_t cacheTiles = 16);
+
+			TiledMatrix(const TiledMatrix& copy) = delete;
+			TiledMatrix& operator = (const TiledMatrix& rhs) = delete;
+
+			/**
+			 * 	@brief	Get a tile, reading it from disk if it is not cached
+			 *
+			 * 	The tile stays valid after being evicted, but is not updated by later writes
+			 *
+			 * 	@param	int							Row of the tile
+			 * 	@param	int							Column of the tile
+			 * 	@return	  std::shared_ptr<const Tile>	The tile
+			 * 	@throws   std::out_of_range
+			 * 	@throws   std::runtime_error		If the tile can't be read, the next call reads it again
+			 *
+			 * 	@version	0.2
+			 */
+			std::shared_ptr<const Tile> readTile(int tileRow, int tileColumn);
+
+			/**
+			 * 	@brief	Replace a tile, it is written to disk on eviction or flush()
+			 *
+			 * 	Any part of the tile outside of M x N is reset to T()
+			 *
+			 * 	@param	int			Row of the tile
+			 * 	@param	int			Column of the tile
+			 * 	@param	Tile			New value of the tile
+			 * 	@throws   std::out_of_range
+			 *
+			 * 	@version	0.1
+			 */
+			void writeTile(int tileRow, int tileColumn, Tile tile);
+
+			/**
+			 * 	@brief	Start reading a tile on the ThreadPool, without waiting for it
+			 *
+			 * 	Does nothing if the tile is already cached, or out of range
+			 *
+			 * 	@version	0.1
+			 */
+			void prefetch(int tileRow, int tileColumn);
+
+			/// Get a single element, through the tile cache
+			T get(int row, int column);
+
+			/**
+			 * 	@brief	Set a single element, through the tile cache
+			 *
+			 * 	The cached tile is changed in place, it is only copied the first
+			 * 	time it is set after readTile() has handed it out
+			 *
+			 * 	@throws   std::out_of_range
+			 * 	@throws   std::runtime_error		If the tile can't be read
+			 *
+			 * 	@version	0.2
+			 */
+			void set(int row, int column, const T& value);
+
+			/**
+			 * 	@brief	Write every modified tile back to disk
+			 *
+			 * 	Call before destruction to find out if the writes succeeded
+			 *
+			 * 	@throws   std::runtime_error		If a tile can't be written
+			 *
+			 * 	@version	0.1
+			 */
+			void flush();
+
+			/// Get the path of the backing file
+			inline const std::string& getPath() const { return this->path; }
+
+			/// Get the width of the Matrix
+			inline int getWidth() const { return N; }
+
+			/// Get the number of rows in the matrix
+			inline int getHeight() const { return M; }
+
+			/**
+			 * 	@brief	Destructor
+			 *
+			 * 	Flushes modified tiles and closes the file, errors writing the
+			 * 	tiles are dropped since a destructor can't throw
+			 *
+			 * 	@version	0.2
+			 */
+			~TiledMatrix();
+
+		private:
+			/// A tile being read, or already in memory
+			struct Load {
+				/// Set by whichever thread runs the read
+				std::atomic<bool> claimed;
+				std::packaged_task<std::shared_ptr<const Tile>()> task;
+				std::shared_future<std::shared_ptr<const Tile>> tile;
+			};
+
+			/// Backing file, shared with reads still running on the pool
+			struct File {
+				int fd;
+				~File();
+			};
+
+			/// Cache entry for a tile
+			struct Entry {
+				std::shared_ptr<Load> load;
+				bool dirty;
+				std::list<long>::iterator position;
+
+				/// The loaded tile while only the cache holds it, so set() can change it in place
+				std::shared_ptr<Tile> writable;
+			};
+
+			/// Path of the backing file
+			std::string path;
+
+			/// Backing file
+			std::shared_ptr<File> file;
+
+			/// Most tiles held in cache
+			std::size_t capacity;
+
+			/// Cached tiles by index
+			std::unordered_map<long, Entry> cache;
+
+			/// Tile indices from most to least recently used
+			std::list<long> recent;
+
+			/// Guards cache and recent
+			std::mutex mutex;
+
+			/// Get the index of the tile, checking the bounds
+			long tileIndex(int tileRow, int tileColumn) const;
+
+			/// Find or start loading a tile, must hold mutex
+			std::shared_ptr<Load> fetch(long index);
+
+			/// Evict tiles until there is room for one more, must hold mutex
+			void makeRoom();
+
+			/// Get the entry of a tile with a writable copy, lock must hold mutex and may be released
+			Entry& writableEntry(long index, std::unique_lock<std::mutex>& lock);
+
+			/// Wrap a tile in a load that has already completed
+			static std::shared_ptr<Load> loaded(std::shared_ptr<const Tile> tile);
+
+			/// Read a tile from the file
+			static std::shared_ptr<const Tile> readFromDisk(const File& file, long index);
+
+			/// Write a tile to the file
+			static void writeToDisk(const File& file, long index, const Tile& tile);
+
+			/// Wait for a load, running it on this thread if nobody has started it
+			static std::shared_ptr<const Tile> complete(const std::shared_ptr<Load>& load);
+
+			/// Complete the load of a tile, dropping it from the cache if the read fails so it is retried
+			std::shared_ptr<const Tile> await(long index, const std::shared_ptr<Load>& load);
+	};
+
+	/**
+	 * 	@brief	Multiply two tiled matrices, streaming the product into result
+	 *
+	 * 	Each output tile accumulates the products of the tiles along its row of
+	 * 	lhs and column of rhs in place, the next pair is prefetched during each product
+	 *
+	 * 	@version	0.2
+	 */
+	template <int M, int N, int R, typename T, int B>
+	void multiply(TiledMatrix<M, N, T, B>& lhs, TiledMatrix<N, R, T, B>& rhs,
+			TiledMatrix<M, R, T, B>& result);
+
+	/// Transpose a tiled matrix into result, one tile at a time
+	template <int M, int N, typename T, int B>
+	void transpose(TiledMatrix<M, N, T, B>& source, TiledMatrix<N, M, T, B>& result);
+
+	/// Add two tiled matrices into result, one tile at a time
+	template <int M, int N, typename T, int B>
+	void add(TiledMatrix<M, N, T, B>& lhs, TiledMatrix<M, N, T, B>& rhs,
+			TiledMatrix<M, N, T, B>& result);
+
+	/// Subtract rhs from lhs into result, one tile at a time
+	template <int M, int N, typename T, int B>
+	void subtract(TiledMatrix<M, N, T, B>& lhs, TiledMatrix<M, N, T, B>& rhs,
+			TiledMatrix<M, N, T, B>& result);
+
+	/// Multiply a tiled matrix by a scalar into result, one tile at a time
+	template <int M, int N, typename T, int B>
+	void scale(TiledMatrix<M, N, T, B>& source, const T& scalar,
+			TiledMatrix<M, N, T, B>& result);
+}
+
+#include "matrix/tiled_matrix.cpp"
+
+#endif
@@ -0,0 +1,166 @@
+/**
+ *  @file		transport.h
+ *  @brief	  Define how the processes of a distributed operation exchange data
+ *
+ * 	A Transport moves raw bytes between numbered processes (ranks).  The
+ * 	default SocketTransport connects local worker processes forked by
+ * 	runLocal() with Unix socket pairs, MPITransport is available when MPI
+ * 	was found at build time.
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-19-2026
+ *  @version	0.1
+ */
+
+#ifndef TRANSPORT_H
+#define TRANSPORT_H
+
+#include <cstddef>
+#include <vector>
+#include <functional>
+
+namespace matrix {
+	namespace distributed {
+
+		/**
+		 * 	@class		Transport
+		 * 	@brief		Point to point messages between the ranks of a distributed operation
+		 *
+		 * 	Messages between one pair of ranks arrive in the order they were sent,
+		 * 	and the receiver always knows the size of the message it expects.
+		 *
+		 */
+		class Transport {
+			public:
+				virtual ~Transport() = default;
+
+				/// Get the rank of this process, 0 to size() - 1
+				virtual int rank() const = 0;
+
+				/// Get the number of processes
+				virtual int size() const = 0;
+
+				/**
+				 * 	@brief	Send bytes to another rank
+				 *
+				 * 	@param	int					Rank to send to
+				 * 	@param	const void*			Data to send
+				 * 	@param	std::size_t			Number of bytes
+				 * 	@throws   std::runtime_error	If the peer is gone
+				 *
+				 * 	@version	0.1
+				 */
+				virtual void send(int to, const void* data, std::size_t bytes) = 0;
+
+				/**
+				 * 	@brief	Receive exactly bytes from another rank
+				 *
+				 * 	@param	int					Rank to receive from
+				 * 	@param	void*					Buffer to fill
+				 * 	@param	std::size_t			Number of bytes
+				 * 	@throws   std::runtime_error	If the peer is gone
+				 *
+				 * 	@version	0.1
+				 */
+				virtual void receive(int from, void* data, std::size_t bytes) = 0;
+
+				/**
+				 * 	@brief	Copy data from root to every other rank in group
+				 *
+				 * 	Every rank of group must call it with the same group and root.
+				 * 	Sends along a binomial tree, so the root sends log2(group) times.
+				 *
+				 * 	@param	const std::vector<int>&	Ranks taking part, in the same order on each
+				 * 	@param	int							Rank holding the data
+				 * 	@param	void*							Data on root, buffer to fill elsewhere
+				 * 	@param	std::size_t					Number of bytes
+				 *
+				 * 	@version	0.1
+				 */
+				virtual void broadcast(const std::vector<int>& group, int root, void* data,
+						std::size_t bytes);
+		};
+
+		/**
+		 * 	@class		SocketTransport
+		 * 	@brief		Transport over one connected Unix socket per pair of ranks
+		 *
+		 */
+		class SocketTransport : public Transport {
+			public:
+				/**
+				 * 	@brief	Take ownership of the sockets to each peer
+				 *
+				 * 	@param	int						Rank of this process
+				 * 	@param	std::vector<int>		Socket connected to each rank, -1 for this rank
+				 *
+				 * 	@version	0.1
+				 */
+				SocketTransport(int rank, std::vector<int> sockets);
+
+				SocketTransport(const SocketTransport& copy) = delete;
+				SocketTransport& operator = (const SocketTransport& rhs) = delete;
+
+				/// Closes the sockets
+				~SocketTransport() override;
+
+				int rank() const override { return this->self; }
+				int size() const override { return static_cast<int>(this->sockets.size()); }
+
+				void send(int to, const void* data, std::size_t bytes) override;
+				void receive(int from, void* data, std::size_t bytes) override;
+
+			private:
+				/// Rank of this process
+				int self;
+
+				/// Socket connected to each rank
+				std::vector<int> sockets;
+		};
+
+#ifdef MATRIX_HAVE_MPI
+		/**
+		 * 	@class		MPITransport
+		 * 	@brief		Transport over MPI_COMM_WORLD
+		 *
+		 * 	MPI must be initialized before construction and finalized by the caller
+		 *
+		 */
+		class MPITransport : public Transport {
+			public:
+				MPITransport();
+
+				int rank() const override { return this->self; }
+				int size() const override { return this->processes; }
+
+				void send(int to, const void* data, std::size_t bytes) override;
+				void receive(int from, void* data, std::size_t bytes) override;
+
+			private:
+				/// Rank of this process
+				int self;
+
+				/// Number of processes
+				int processes;
+		};
+#endif
+
+		/**
+		 * 	@brief	Run body on processes local ranks connected by a SocketTransport
+		 *
+		 * 	The calling process is rank 0, the others are forked from it and exit
+		 * 	once body returns.  A forked process has only the thread that forked it,
+		 * 	so it builds its own ThreadPool with a single worker, the ranks being
+		 * 	the parallelism.
+		 *
+		 * 	@param	int									Number of processes, at least 1
+		 * 	@param	std::function<void(Transport&)>	Run by every rank
+		 * 	@throws   std::runtime_error				If a worker can't start or fails
+		 *
+		 * 	@version	0.1
+		 */
+		void runLocal(int processes, const std::function<void(Transport&)>& body);
+	}
+}
+
+#endif
@@ -0,0 +1,171 @@
+/**
+ *  @file		triangular_matrix.cpp
+ *  @brief	  Implement the template code for a packed triangular matrix
+ *
+ * 	Details
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-19-2026
+ *  @version	0.1
+ */
+
+#include "triangular_matrix.h"
+
+namespace matrix {
+	//
+	// Fill Constructor
+	//
+	template <int N, typename T, Triangle Side>
+	TriangularMatrix<N, T, Side>::TriangularMatrix(T value) :
+			packed(PACKED_SIZE, value) {
+
+	}
+
+	//
+	// Dense Constructor
+	//
+	template <int N, typename T, Triangle Side>
+	TriangularMatrix<N, T, Side>::TriangularMatrix(const Matrix<N, N, T>& dense) :
+			packed(PACKED_SIZE) {
+		for(int row = 0; row < N; ++row) {
+			for(int column = firstColumn(row); column < lastColumn(row); ++column)
+				this->packed[index(row, column)] = dense[row][column];
+		}
+	}
+
+	//
+	// get (int, int) -> T
+	//
+	template <int N, typename T, Triangle Side>
+	T TriangularMatrix<N, T, Side>::get(int row, int column) const {
+		if(row < 0 || row >= N || column < 0 || column >= N)
+			throw std::out_of_range("Index must be within the matrix");
+
+		return contains(row, column) ? this->packed[index(row, column)] : T();
+	}
+
+	//
+	// set (int, int, const T&) -> void
+	//
+	template <int N, typename T, Triangle Side>
+	void TriangularMatrix<N, T, Side>::set(int row, int column, const T& value) {
+		if(row < 0 || row >= N || column < 0 || column >= N || !contains(row, column))
+			throw std::out_of_range("Index must be within the stored triangle");
+
+		this->packed[index(row, column)] = value;
+	}
+
+	//
+	// operator * (const Matrix<N, R, T>&) -> Matrix<N, R, T>
+	//
+	template <int N, typename T, Triangle Side>
+	template <int R>
+	Matrix<N, R, T> TriangularMatrix<N, T, Side>::operator * (const Matrix<N, R, T>& rhs) const {
+		Matrix<N, R, T> result;
+
+		// Each output row combines only the rows of rhs inside the triangle
+		kernels::forRows(N, static_cast<long long>(N) * R / 2, [&] (int begin, int end) {
+			for(int row = begin; row < end; ++row) {
+				T* out = result[row].data();
+				const T* coefficients = this->packed.data() + rowStart(row) - firstColumn(row);
+				for(int k = firstColumn(row); k < lastColumn(row); ++k) {
+					const T scalar = coefficients[k];
+					const T* right = rhs[k].data();
+					for(int column = 0; column < R; ++column)
+						out[column] += scalar * right[column];
+				}
+			}
+		});
+
+		return result;
+	}
+
+	//
+	// solve (const Matrix<N, R, T>&) -> Matrix<N, R, T>
+	//
+	template <int N, typename T, Triangle Side>
+	template <int R>
+	Matrix<N, R, T> TriangularMatrix<N, T, Side>::solve(const Matrix<N, R, T>& rhs) const {
+		Matrix<N, R, T> result(rhs);
+
+		// Lower solves top to bottom, upper bottom to top, each row only needs solved rows
+		for(int step = 0; step < N; ++step) {
+			int row = (Side == Triangle::Lower) ? step : N - 1 - step;
+			const T* coefficients = this->packed.data() + rowStart(row) - firstColumn(row);
+			T* out = result[row].data();
+
+			for(int k = firstColumn(row); k < lastColumn(row); ++k) {
+				if(k == row)
+					continue;
+				const T scalar = coefficients[k];
+				const T* solved = result[k].data();
+				for(int column = 0; column < R; ++column)
+					out[column] -= scalar * solved[column];
+			}
+
+			const T pivot = coefficients[row];
+			if(pivot == T())
+				throw std::domain_error("Triangular matrix is singular");
+			for(int column = 0; column < R; ++column)
+				out[column] = out[column] / pivot;
+		}
+
+		return result;
+	}
+
+	//
+	// transpose () -> TriangularMatrix<N, T, other side>
+	//
+	template <int N, typename T, Triangle Side>
+	TriangularMatrix<N, T, (Side == Triangle::Lower ? Triangle::Upper : Triangle::Lower)>
+			TriangularMatrix<N, T, Side>::transpose() const {
+		TriangularMatrix<N, T, (Side == Triangle::Lower ? Triangle::Upper : Triangle::Lower)> result;
+		for(int row = 0; row < N; ++row) {
+			for(int column = firstColumn(row); column < lastColumn(row); ++column)
+				result.set(column, row, this->packed[index(row, column)]);
+		}
+
+		return result;
+	}
+
+	//
+	// toDense () -> Matrix<N, N, T>
+	//
+	template <int N, typename T, Triangle Side>
+	Matrix<N, N, T> TriangularMatrix<N, T, Side>::toDense() const {
+		Matrix<N, N, T> result;
+		for(int row = 0; row < N; ++row) {
+			for(int column = firstColumn(row); column < lastColumn(row); ++column)
+				result[row][column] = this->packed[index(row, column)];
+		}
+
+		return result;
+	}
+
+	//
+	// operator * (const Matrix<M, N, T>&, const TriangularMatrix<N, T, Side>&) -> Matrix<M, N, T>
+	//
+	template <int M, int N, typename T, Triangle Side>
+	Matrix<M, N, T> operator * (const Matrix<M, N, T>& lhs, const TriangularMatrix<N, T, Side>& rhs) {
+		using Triangular = TriangularMatrix<N, T, Side>;
+		Matrix<M, N, T> result;
+		const T* packed = rhs.getPacked().data();
+
+		// Each output row adds lhs(row, k) times the stored part of row k of rhs
+		kernels::forRows(M, static_cast<long long>(N) * N / 2, [&] (int begin, int end) {
+			for(int row = begin; row < end; ++row) {
+				T* out = result[row].data();
+				const T* left = lhs[row].data();
+				for(int k = 0; k < N; ++k) {
+					const T scalar = left[k];
+					const int first = Triangular::firstColumn(k);
+					const T* stored = packed + Triangular::rowStart(k) - first;
+					for(int column = first; column < Triangular::lastColumn(k); ++column)
+						out[column] += scalar * stored[column];
+				}
+			}
+		});
+
+		return result;
+	}
+}
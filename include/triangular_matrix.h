@@ -0,0 +1,149 @@
+/**
+ *  @file		triangular_matrix.h
+ *  @brief	  Define a square matrix that packs one triangle into contiguous storage
+ *
+ * 	Products and solves with a dense Matrix only touch the stored triangle
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-19-2026
+ *  @version	0.1
+ */
+
+#ifndef TRIANGULAR_MATRIX_H
+#define TRIANGULAR_MATRIX_H
+
+#include <vector>
+#include <stdexcept>
+
+#include "matrix/matrix.h"
+
+namespace matrix {
+
+	/// Which triangle of a TriangularMatrix is stored
+	enum class Triangle { Upper, Lower };
+
+	/**
+	 * 	@class		TriangularMatrix
+	 * 	@brief		N x N matrix that is T() on one side of the diagonal
+	 *
+	 * 	Stores the N(N+1)/2 entries of the triangle row by row
+	 *
+	 */
+	template <int N = 3, typename T = double, Triangle Side = Triangle::Lower>
+	class TriangularMatrix {
+		public:
+			/// Number of stored entries
+			static constexpr std::size_t PACKED_SIZE = static_cast<std::size_t>(N) * (N + 1) / 2;
+
+			/**
+			 * 	@brief	Fill Constructor
+			 *
+			 * 	Fills the triangle (including the diagonal) with the value provided
+			 *
+			 * 	@version	0.1
+			 */
+			explicit TriangularMatrix(T value = T());
+
+			/**
+			 * 	@brief	Build from the matching triangle of a dense matrix
+			 *
+			 * 	The other triangle of dense is ignored
+			 *
+			 * 	@version	0.1
+			 */
+			explicit TriangularMatrix(const Matrix<N, N, T>& dense);
+
+			/// Check if (row, column) is inside the stored triangle
+			static inline bool contains(int row, int column) {
+				return (Side == Triangle::Lower) ? column <= row : column >= row;
+			}
+
+			/// Get the entry at (row, column), T() outside of the triangle
+			T get(int row, int column) const;
+
+			/**
+			 * 	@brief	Set the entry at (row, column)
+			 *
+			 * 	@throws   std::out_of_range		If (row, column) is outside of the triangle
+			 *
+			 * 	@version	0.1
+			 */
+			void set(int row, int column, const T& value);
+
+			/**
+			 * 	@brief	Multiply with a dense matrix, skipping the zero triangle
+			 *
+			 * 	@param	const Matrix<N, R, T>&	Right hand side
+			 * 	@return	  Matrix<N, R, T>			Product, about half the work of a dense product
+			 *
+			 * 	@version	0.1
+			 */
+			template <int R>
+			Matrix<N, R, T> operator * (const Matrix<N, R, T>& rhs) const;
+
+			/**
+			 * 	@brief	Solve this * X = rhs for X by forward or back substitution
+			 *
+			 * 	@throws   std::domain_error		If an entry of the diagonal is T()
+			 *
+			 * 	@version	0.1
+			 */
+			template <int R>
+			Matrix<N, R, T> solve(const Matrix<N, R, T>& rhs) const;
+
+			/// Build the transpose, which stores the other triangle
+			TriangularMatrix<N, T, (Side == Triangle::Lower ? Triangle::Upper : Triangle::Lower)>
+					transpose() const;
+
+			/// Build the dense form of the matrix
+			Matrix<N, N, T> toDense() const;
+
+			/// Get the packed entries, row by row
+			inline const std::vector<T>& getPacked() const { return this->packed; }
+
+			/// Get the width of the Matrix
+			inline int getWidth() const { return N; }
+
+			/// Get the number of rows in the matrix
+			inline int getHeight() const { return N; }
+
+			/// Index into packed of the first stored entry of a row
+			static inline std::size_t rowStart(int row) {
+				const std::size_t r = static_cast<std::size_t>(row);
+				return (Side == Triangle::Lower) ? r * (r + 1) / 2 : r * N - r * (r - 1) / 2;
+			}
+
+			/// First stored column of a row
+			static inline int firstColumn(int row) { return (Side == Triangle::Lower) ? 0 : row; }
+
+			/// One past the last stored column of a row
+			static inline int lastColumn(int row) { return (Side == Triangle::Lower) ? row + 1 : N; }
+
+			/// Index into packed of (row, column), which must be in the triangle
+			static inline std::size_t index(int row, int column) {
+				return rowStart(row) + (column - firstColumn(row));
+			}
+
+		private:
+			/// Entries of the triangle, row by row
+			std::vector<T> packed;
+	};
+
+	/**
+	 * 	@brief	Multiply a dense matrix with a triangular one, skipping the zero triangle
+	 *
+	 * 	Row k of rhs only adds into its stored columns, read contiguously from the packed row
+	 *
+	 * 	@param	const Matrix<M, N, T>&					Left hand side
+	 * 	@param	const TriangularMatrix<N, T, Side>&	Right hand side
+	 * 	@return	  Matrix<M, N, T>							Product, about half the work of a dense product
+	 *
+	 * 	@version	0.1
+	 */
+	template <int M, int N, typename T, Triangle Side>
+	Matrix<M, N, T> operator * (const Matrix<M, N, T>& lhs, const TriangularMatrix<N, T, Side>& rhs);
+}
+
+#include "matrix/triangular_matrix.cpp"
+
+#endif
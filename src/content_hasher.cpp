@@ -0,0 +1,140 @@
+/**
+ *  @file		content_hasher.cpp
+ *  @brief	  Implement the streaming XXH64 content hash
+ *
+ * 	Details
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-19-2026
+ *  @version	0.1
+ */
+
+#include <algorithm>
+#include <cstring>
+
+#include "content_hasher.h"
+
+namespace matrix {
+	/// XXH64 primes
+	static constexpr std::uint64_t PRIME_1 = 11400714785074694791ULL;
+	static constexpr std::uint64_t PRIME_2 = 14029467366897019727ULL;
+	static constexpr std::uint64_t PRIME_3 = 1609587929392839161ULL;
+	static constexpr std::uint64_t PRIME_4 = 9650029242287828579ULL;
+	static constexpr std::uint64_t PRIME_5 = 2870177450012600261ULL;
+
+	static inline std::uint64_t rotateLeft(std::uint64_t value, int bits) {
+		return (value << bits) | (value >> (64 - bits));
+	}
+
+	/// Read 8 bytes as a little endian word
+	static inline std::uint64_t read64(const unsigned char* bytes) {
+		std::uint64_t value = 0;
+		for(int i = 7; i >= 0; --i)
+			value = (value << 8) | bytes[i];
+		return value;
+	}
+
+	/// Read 4 bytes as a little endian word
+	static inline std::uint64_t read32(const unsigned char* bytes) {
+		return static_cast<std::uint64_t>(bytes[0]) | static_cast<std::uint64_t>(bytes[1]) << 8
+				| static_cast<std::uint64_t>(bytes[2]) << 16 | static_cast<std::uint64_t>(bytes[3]) << 24;
+	}
+
+	static inline std::uint64_t roundLane(std::uint64_t lane, std::uint64_t input) {
+		lane += input * PRIME_2;
+		return rotateLeft(lane, 31) * PRIME_1;
+	}
+
+	static inline std::uint64_t mergeRound(std::uint64_t hash, std::uint64_t lane) {
+		hash ^= roundLane(0, lane);
+		return hash * PRIME_1 + PRIME_4;
+	}
+
+	//
+	// Constructor
+	//
+	ContentHasher::ContentHasher(std::uint64_t seed) :
+			seed(seed),
+			lanes{seed + PRIME_1 + PRIME_2, seed + PRIME_2, seed, seed - PRIME_1},
+			buffered(0),
+			total(0) {
+
+	}
+
+	//
+	// consume (const unsigned char*) -> void
+	//
+	void ContentHasher::consume(const unsigned char* stripe) {
+		for(int lane = 0; lane < 4; ++lane)
+			this->lanes[lane] = roundLane(this->lanes[lane], read64(stripe + 8 * lane));
+	}
+
+	//
+	// update (const void*, std::size_t) -> void
+	//
+	void ContentHasher::update(const void* data, std::size_t bytes) {
+		const unsigned char* next = static_cast<const unsigned char*>(data);
+		this->total += bytes;
+
+		// Top up a partial stripe first
+		if(this->buffered > 0) {
+			std::size_t taken = std::min(bytes, sizeof(this->buffer) - this->buffered);
+			std::memcpy(this->buffer + this->buffered, next, taken);
+			this->buffered += taken;
+			next += taken;
+			bytes -= taken;
+			if(this->buffered < sizeof(this->buffer))
+				return;
+			this->consume(this->buffer);
+			this->buffered = 0;
+		}
+
+		for(; bytes >= 32; next += 32, bytes -= 32)
+			this->consume(next);
+
+		std::memcpy(this->buffer, next, bytes);
+		this->buffered = bytes;
+	}
+
+	//
+	// digest () -> std::uint64_t
+	//
+	std::uint64_t ContentHasher::digest() const {
+		std::uint64_t hash;
+		if(this->total >= 32) {
+			hash = rotateLeft(this->lanes[0], 1) + rotateLeft(this->lanes[1], 7)
+					+ rotateLeft(this->lanes[2], 12) + rotateLeft(this->lanes[3], 18);
+			for(std::uint64_t lane : this->lanes)
+				hash = mergeRound(hash, lane);
+		}
+		else
+			hash = this->seed + PRIME_5;
+		hash += this->total;
+
+		// Fold in the bytes short of a stripe
+		const unsigned char* next = this->buffer;
+		std::size_t bytes = this->buffered;
+		for(; bytes >= 8; next += 8, bytes -= 8) {
+			hash ^= roundLane(0, read64(next));
+			hash = rotateLeft(hash, 27) * PRIME_1 + PRIME_4;
+		}
+		if(bytes >= 4) {
+			hash ^= read32(next) * PRIME_1;
+			hash = rotateLeft(hash, 23) * PRIME_2 + PRIME_3;
+			next += 4;
+			bytes -= 4;
+		}
+		for(; bytes > 0; ++next, --bytes) {
+			hash ^= *next * PRIME_5;
+			hash = rotateLeft(hash, 11) * PRIME_1;
+		}
+
+		// Avalanche
+		hash ^= hash >> 33;
+		hash *= PRIME_2;
+		hash ^= hash >> 29;
+		hash *= PRIME_3;
+		hash ^= hash >> 32;
+		return hash;
+	}
+}
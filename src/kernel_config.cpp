@@ -0,0 +1,110 @@
+/**
+ *  @file		kernel_config.cpp
+ *  @brief	  Implement loading and saving the tunable kernel parameters
+ *
+ * 	Details
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-19-2026
+ *  @version	0.1
+ */
+
+#include <cstdlib>
+#include <fstream>
+
+#include "kernel_config.h"
+
+namespace matrix {
+	//
+	// Default Constructor
+	//
+	KernelConfig::KernelConfig() {
+		this->reset();
+	}
+
+	//
+	// getInstance () -> KernelConfig&
+	//
+	KernelConfig& KernelConfig::getInstance() {
+		static KernelConfig config;
+		static bool loaded = config.load(KernelConfig::getDefaultPath());
+		(void) loaded;
+		return config;
+	}
+
+	//
+	// getDefaultPath () -> std::string
+	//
+	std::string KernelConfig::getDefaultPath() {
+		const char* path = std::getenv("MATRIX_KERNEL_CONFIG");
+		return (path && *path) ? path : DEFAULT_PATH;
+	}
+
+	//
+	// load (const std::string&) -> bool
+	//
+	bool KernelConfig::load(const std::string& path) {
+		std::ifstream file(path);
+		if(!file)
+			return false;
+
+		std::string line;
+		while(std::getline(file, line)) {
+			// Drop comments, and skip anything that isn't key=value
+			line = line.substr(0, line.find('#'));
+			std::size_t equals = line.find('=');
+			if(equals == std::string::npos)
+				continue;
+
+			std::string key = line.substr(0, equals);
+			key.erase(0, key.find_first_not_of(" \t"));
+			key.erase(key.find_last_not_of(" \t") + 1);
+
+			char* end = nullptr;
+			long value = std::strtol(line.c_str() + equals + 1, &end, 10);
+			if(end == line.c_str() + equals + 1 || value <= 0)
+				continue;
+
+			if(key == "gemm_block_size")
+				this->gemmBlockSize = static_cast<int>(value);
+			else if(key == "transpose_block_size")
+				this->transposeBlockSize = static_cast<int>(value);
+			else if(key == "gemm_threshold")
+				this->gemmThreshold = value;
+			else if(key == "elementwise_threshold")
+				this->elementwiseThreshold = value;
+			else if(key == "parallel_threshold")
+				// Files from before the thresholds were split set both
+				this->setParallelThreshold(value);
+		}
+
+		return true;
+	}
+
+	//
+	// save (const std::string&) -> bool
+	//
+	bool KernelConfig::save(const std::string& path) const {
+		std::ofstream file(path);
+		if(!file)
+			return false;
+
+		file << "# matrix kernel configuration, written by matrix_tune\n"
+				<< "gemm_block_size=" << this->gemmBlockSize << '\n'
+				<< "transpose_block_size=" << this->transposeBlockSize << '\n'
+				<< "gemm_threshold=" << this->gemmThreshold << '\n'
+				<< "elementwise_threshold=" << this->elementwiseThreshold << '\n';
+
+		return static_cast<bool>(file);
+	}
+
+	//
+	// reset () -> void
+	//
+	void KernelConfig::reset() {
+		this->gemmBlockSize = DEFAULT_GEMM_BLOCK_SIZE;
+		this->transposeBlockSize = DEFAULT_TRANSPOSE_BLOCK_SIZE;
+		this->gemmThreshold = DEFAULT_GEMM_THRESHOLD;
+		this->elementwiseThreshold = DEFAULT_ELEMENTWISE_THRESHOLD;
+	}
+}
@@ -0,0 +1,28 @@
+/**
+ *  @file		matrix_instantiations.cpp
+ *  @brief	  Compile the common Matrix types and kernels once into the library
+ *
+ * 	matrix.h and kernels.h declare these extern, so code that includes them
+ * 	links against the copies here instead of instantiating its own.
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-19-2026
+ *  @version	0.1
+ */
+
+#include "matrix/matrix.h"
+
+namespace matrix {
+#define MATRIX_INSTANTIATE(M, N, T) template class Matrix<M, N, T>;
+	MATRIX_EXPLICIT_INSTANTIATIONS(MATRIX_INSTANTIATE)
+#undef MATRIX_INSTANTIATE
+
+	namespace kernels {
+#define MATRIX_INSTANTIATE_KERNELS(T) \
+		template void gemm<T>(const T* const*, const T* const*, T* const*, int, int, int, int, int); \
+		template void parallelGemm<T>(const T* const*, const T* const*, T* const*, int, int, int); \
+		template void transpose<T>(const T* const*, T* const*, int, int, int);
+		MATRIX_KERNEL_TYPES(MATRIX_INSTANTIATE_KERNELS)
+#undef MATRIX_INSTANTIATE_KERNELS
+	}
+}
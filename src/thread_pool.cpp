@@ -0,0 +1,331 @@
+/**
+ *  @file		thread_pool.cpp
+ *  @brief	  Implement the pool of worker threads shared by the matrix library
+ *
+ * 	Details
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-19-2026
+ *  @version	0.2
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <atomic>
+
+#include <pthread.h>
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+#ifdef MATRIX_HAVE_NUMA
+#include <numa.h>
+#endif
+
+#include "thread_pool.h"
+
+namespace matrix {
+	/// Index of the worker on this thread, -1 on other threads
+	static thread_local int workerIndex = -1;
+
+	/// Pool of this process, forgotten by a forked child so it builds its own
+	static std::atomic<ThreadPool*> instance(nullptr);
+
+	/// Guards building the pool, held across fork() so a child never inherits it locked
+	static std::mutex instanceMutex;
+
+	/// How the next pool is built, set by configureInstance()
+	static unsigned int instanceThreads = 0;
+	static int instancePinned = -1;
+
+	//
+	// Constructor
+	//
+	ThreadPool::ThreadPool(unsigned int numThreads, bool pinned, std::chrono::microseconds stealAfter) :
+			stopping(false),
+			stealAfter(stealAfter) {
+		this->placeWorkers(numThreads, pinned);
+		for(unsigned int i = 0; i < this->cpus.size(); ++i)
+			this->queues.push_back(std::make_unique<WorkerQueue>());
+
+		for(unsigned int i = 0; i < this->cpus.size(); ++i)
+			this->workers.emplace_back(&ThreadPool::workerLoop, this, i);
+	}
+
+	//
+	// getInstance () -> ThreadPool&
+	//
+	ThreadPool& ThreadPool::getInstance() {
+		ThreadPool* pool = instance.load(std::memory_order_acquire);
+		if(pool)
+			return *pool;
+
+		std::lock_guard<std::mutex> lock(instanceMutex);
+		pool = instance.load(std::memory_order_relaxed);
+		if(pool)
+			return *pool;
+
+		// The child keeps the forking thread only, and leaves the parent's pool alone
+		static bool watchingForks = pthread_atfork(
+				[] () { instanceMutex.lock(); },
+				[] () { instanceMutex.unlock(); },
+				[] () {
+					instance.store(nullptr);
+					instanceThreads = 0;
+					instancePinned = -1;
+					workerIndex = -1;
+					instanceMutex.unlock();
+				}) == 0;
+		(void) watchingForks;
+
+		if(instancePinned < 0) {
+			const char* pin = std::getenv("MATRIX_PIN_THREADS");
+			instancePinned = !(pin && std::strcmp(pin, "0") == 0);
+		}
+		pool = new ThreadPool(instanceThreads, instancePinned != 0);
+		instance.store(pool, std::memory_order_release);
+
+		// Finish the queued jobs and join the workers at exit, of whichever pool this process owns
+		static struct Owner {
+			~Owner() { delete instance.exchange(nullptr); }
+		} owner;
+		(void) owner;
+		return *pool;
+	}
+
+	//
+	// configureInstance (unsigned int, bool) -> bool
+	//
+	bool ThreadPool::configureInstance(unsigned int numThreads, bool pinned) {
+		std::lock_guard<std::mutex> lock(instanceMutex);
+		if(instance.load())
+			return false;
+
+		instanceThreads = numThreads;
+		instancePinned = pinned;
+		return true;
+	}
+
+	//
+	// isWorkerThread () -> bool
+	//
+	bool ThreadPool::isWorkerThread() {
+		return workerIndex >= 0;
+	}
+
+	//
+	// currentWorker () -> int
+	//
+	int ThreadPool::currentWorker() {
+		return workerIndex;
+	}
+
+	//
+	// post (std::function<void()>) -> void
+	//
+	void ThreadPool::post(std::function<void()> job) {
+		std::lock_guard<std::mutex> lock(this->mutex);
+		this->jobs.push_back(std::move(job));
+		this->wakeOne(-1);
+	}
+
+	//
+	// postTo (unsigned int, std::function<void()>) -> void
+	//
+	void ThreadPool::postTo(unsigned int worker, std::function<void()> job) {
+		std::lock_guard<std::mutex> lock(this->mutex);
+		int target = static_cast<int>(worker % this->queues.size());
+		WorkerQueue& queue = *this->queues[target];
+		queue.jobs.emplace_back(Clock::now(), std::move(job));
+
+		// Only the target is woken, unless it is busy and someone else may need to step in
+		if(queue.sleeping) {
+			queue.sleeping = false;
+			queue.wake.notify_one();
+		}
+		else if(queue.busy)
+			this->wakeOne(target);
+	}
+
+	//
+	// wakeOne (int) -> void
+	//
+	void ThreadPool::wakeOne(int skip) {
+		for(int i = 0; i < static_cast<int>(this->queues.size()); ++i) {
+			WorkerQueue& queue = *this->queues[i];
+			if(i != skip && queue.sleeping) {
+				// Cleared here so the next wake reaches a different worker
+				queue.sleeping = false;
+				queue.wake.notify_one();
+				return;
+			}
+		}
+	}
+
+	//
+	// takeJob (int, Clock::time_point&) -> std::function<void()>
+	//
+	std::function<void()> ThreadPool::takeJob(int worker, Clock::time_point& nextSteal) {
+		std::function<void()> job;
+		if(worker >= 0) {
+			auto& own = this->queues[worker]->jobs;
+			if(!own.empty()) {
+				job = std::move(own.front().second);
+				own.pop_front();
+				return job;
+			}
+			if(!this->jobs.empty()) {
+				job = std::move(this->jobs.front());
+				this->jobs.pop_front();
+				return job;
+			}
+		}
+
+		// Jobs that waited too long on another worker, oldest first
+		Clock::time_point now = Clock::now();
+		nextSteal = Clock::time_point::max();
+		int oldest = -1;
+		for(int i = 0; i < static_cast<int>(this->queues.size()); ++i) {
+			const auto& other = this->queues[i]->jobs;
+			if(i == worker || other.empty())
+				continue;
+			if(oldest < 0 || other.front().first < this->queues[oldest]->jobs.front().first)
+				oldest = i;
+		}
+		if(oldest >= 0) {
+			auto& other = this->queues[oldest]->jobs;
+			if(now - other.front().first >= this->stealAfter) {
+				job = std::move(other.front().second);
+				other.pop_front();
+			}
+			else
+				nextSteal = other.front().first + this->stealAfter;
+		}
+		return job;
+	}
+
+	//
+	// runOverdue () -> bool
+	//
+	bool ThreadPool::runOverdue() {
+		std::function<void()> job;
+		{
+			std::lock_guard<std::mutex> lock(this->mutex);
+			Clock::time_point nextSteal;
+			job = this->takeJob(-1, nextSteal);
+		}
+		if(!job)
+			return false;
+
+		job();
+		return true;
+	}
+
+	//
+	// placeWorkers (unsigned int, bool) -> void
+	//
+	void ThreadPool::placeWorkers(unsigned int numThreads, bool pinned) {
+		// Gather the CPUs this process may run on, with their NUMA node
+		std::vector<std::pair<int, int>> available;
+#ifdef __linux__
+		cpu_set_t allowed;
+		CPU_ZERO(&allowed);
+		if(sched_getaffinity(0, sizeof(allowed), &allowed) == 0) {
+#ifdef MATRIX_HAVE_NUMA
+			bool numa = numa_available() >= 0;
+#endif
+			for(int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+				if(!CPU_ISSET(cpu, &allowed))
+					continue;
+				int node = -1;
+#ifdef MATRIX_HAVE_NUMA
+				if(numa)
+					node = numa_node_of_cpu(cpu);
+#endif
+				available.emplace_back(node, cpu);
+			}
+		}
+#endif
+
+		if(numThreads == 0)
+			numThreads = available.empty() ?
+					std::max(1u, std::thread::hardware_concurrency()) : available.size();
+
+		// Neighbouring workers share a node, so neighbouring chunks do too
+		std::stable_sort(available.begin(), available.end(),
+				[] (const std::pair<int, int>& a, const std::pair<int, int>& b) {
+			return a.first < b.first;
+		});
+
+		for(unsigned int i = 0; i < numThreads; ++i) {
+			bool placed = pinned && !available.empty();
+			const auto& choice = placed ? available[i % available.size()] : std::pair<int, int>(-1, -1);
+			this->nodes.push_back(choice.first);
+			this->cpus.push_back(choice.second);
+		}
+	}
+
+	//
+	// workerLoop (unsigned int) -> void
+	//
+	void ThreadPool::workerLoop(unsigned int worker) {
+		workerIndex = static_cast<int>(worker);
+
+#ifdef __linux__
+		// Pin to the chosen CPU, staying unpinned if that isn't allowed
+		if(this->cpus[worker] >= 0) {
+			cpu_set_t cpu;
+			CPU_ZERO(&cpu);
+			CPU_SET(this->cpus[worker], &cpu);
+			pthread_setaffinity_np(pthread_self(), sizeof(cpu), &cpu);
+		}
+#endif
+
+		WorkerQueue& own = *this->queues[worker];
+		std::unique_lock<std::mutex> lock(this->mutex);
+		while(true) {
+			Clock::time_point nextSteal;
+			std::function<void()> job = this->takeJob(static_cast<int>(worker), nextSteal);
+			if(job) {
+				// Others may have to take what is still queued behind this job
+				own.busy = true;
+				if(!own.jobs.empty())
+					this->wakeOne(static_cast<int>(worker));
+
+				lock.unlock();
+				job();
+				job = nullptr;
+				lock.lock();
+				own.busy = false;
+				continue;
+			}
+
+			// Only leave once every queue has drained
+			if(this->stopping && nextSteal == Clock::time_point::max())
+				return;
+
+			own.sleeping = true;
+			if(nextSteal == Clock::time_point::max())
+				own.wake.wait(lock);
+			else
+				own.wake.wait_until(lock, nextSteal);
+			own.sleeping = false;
+		}
+	}
+
+	//
+	// Destructor
+	//
+	ThreadPool::~ThreadPool() {
+		{
+			std::lock_guard<std::mutex> lock(this->mutex);
+			this->stopping = true;
+			for(auto& queue : this->queues)
+				queue->wake.notify_all();
+		}
+
+		for(auto& worker : this->workers)
+			worker.join();
+	}
+}
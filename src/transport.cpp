@@ -0,0 +1,271 @@
+/**
+ *  @file		transport.cpp
+ *  @brief	  Implement the transports for distributed operations
+ *
+ * 	Details
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-19-2026
+ *  @version	0.1
+ */
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <string>
+#include <iostream>
+#include <stdexcept>
+
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+
+#ifdef MATRIX_HAVE_MPI
+#include <mpi.h>
+#endif
+
+#include "thread_pool.h"
+#include "transport.h"
+
+namespace matrix {
+	namespace distributed {
+		//
+		// broadcast (const std::vector<int>&, int, void*, std::size_t) -> void
+		//
+		void Transport::broadcast(const std::vector<int>& group, int root, void* data,
+				std::size_t bytes) {
+			int count = static_cast<int>(group.size());
+			int rootIndex = -1, selfIndex = -1;
+			for(int i = 0; i < count; ++i) {
+				if(group[i] == root)
+					rootIndex = i;
+				if(group[i] == this->rank())
+					selfIndex = i;
+			}
+			if(rootIndex < 0 || selfIndex < 0)
+				throw std::invalid_argument("broadcast group must hold the root and this rank");
+
+			// Number the group from the root, each rank receives from the rank
+			// with its lowest set bit cleared, then sends on to the ranks below it
+			int relative = (selfIndex - rootIndex + count) % count;
+			int mask = 1;
+			for(; mask < count; mask <<= 1) {
+				if(relative & mask) {
+					this->receive(group[(relative - mask + rootIndex) % count], data, bytes);
+					break;
+				}
+			}
+			for(mask >>= 1; mask > 0; mask >>= 1) {
+				if(relative + mask < count)
+					this->send(group[(relative + mask + rootIndex) % count], data, bytes);
+			}
+		}
+
+		//
+		// SocketTransport Constructor
+		//
+		SocketTransport::SocketTransport(int rank, std::vector<int> sockets) :
+				self(rank), sockets(std::move(sockets)) {
+
+		}
+
+		//
+		// SocketTransport Destructor
+		//
+		SocketTransport::~SocketTransport() {
+			for(int socket : this->sockets) {
+				if(socket >= 0)
+					::close(socket);
+			}
+		}
+
+		//
+		// send (int, const void*, std::size_t) -> void
+		//
+		void SocketTransport::send(int to, const void* data, std::size_t bytes) {
+			const char* next = static_cast<const char*>(data);
+			while(bytes > 0) {
+				ssize_t sent = ::send(this->sockets.at(to), next, bytes, MSG_NOSIGNAL);
+				if(sent < 0 && errno == EINTR)
+					continue;
+				if(sent <= 0)
+					throw std::runtime_error("send to rank " + std::to_string(to) + " failed: "
+							+ std::strerror(errno));
+				next += sent;
+				bytes -= static_cast<std::size_t>(sent);
+			}
+		}
+
+		//
+		// receive (int, void*, std::size_t) -> void
+		//
+		void SocketTransport::receive(int from, void* data, std::size_t bytes) {
+			char* next = static_cast<char*>(data);
+			while(bytes > 0) {
+				ssize_t received = ::recv(this->sockets.at(from), next, bytes, 0);
+				if(received < 0 && errno == EINTR)
+					continue;
+				if(received == 0)
+					throw std::runtime_error("rank " + std::to_string(from) + " closed the connection");
+				if(received < 0)
+					throw std::runtime_error("receive from rank " + std::to_string(from) + " failed: "
+							+ std::strerror(errno));
+				next += received;
+				bytes -= static_cast<std::size_t>(received);
+			}
+		}
+
+#ifdef MATRIX_HAVE_MPI
+		//
+		// MPITransport Constructor
+		//
+		MPITransport::MPITransport() {
+			MPI_Comm_rank(MPI_COMM_WORLD, &this->self);
+			MPI_Comm_size(MPI_COMM_WORLD, &this->processes);
+		}
+
+		//
+		// send (int, const void*, std::size_t) -> void
+		//
+		void MPITransport::send(int to, const void* data, std::size_t bytes) {
+			// MPI counts are ints, split larger messages
+			const char* next = static_cast<const char*>(data);
+			do {
+				int count = static_cast<int>(std::min<std::size_t>(bytes, INT_MAX));
+				if(MPI_Send(next, count, MPI_BYTE, to, 0, MPI_COMM_WORLD) != MPI_SUCCESS)
+					throw std::runtime_error("MPI_Send to rank " + std::to_string(to) + " failed");
+				next += count;
+				bytes -= static_cast<std::size_t>(count);
+			} while(bytes > 0);
+		}
+
+		//
+		// receive (int, void*, std::size_t) -> void
+		//
+		void MPITransport::receive(int from, void* data, std::size_t bytes) {
+			char* next = static_cast<char*>(data);
+			do {
+				int count = static_cast<int>(std::min<std::size_t>(bytes, INT_MAX));
+				if(MPI_Recv(next, count, MPI_BYTE, from, 0, MPI_COMM_WORLD, MPI_STATUS_IGNORE) != MPI_SUCCESS)
+					throw std::runtime_error("MPI_Recv from rank " + std::to_string(from) + " failed");
+				next += count;
+				bytes -= static_cast<std::size_t>(count);
+			} while(bytes > 0);
+		}
+#endif
+
+		//
+		// runLocal (int, const std::function<void(Transport&)>&) -> void
+		//
+		void runLocal(int processes, const std::function<void(Transport&)>& body) {
+			if(processes < 1)
+				throw std::invalid_argument("runLocal needs at least one process");
+
+			// Connect every pair of ranks before forking, sockets[i][j] is i's end
+			std::vector<std::vector<int>> sockets(processes, std::vector<int>(processes, -1));
+			auto closeAll = [&sockets] () {
+				for(auto& ends : sockets) {
+					for(int& socket : ends) {
+						if(socket >= 0)
+							::close(socket);
+						socket = -1;
+					}
+				}
+			};
+			for(int i = 0; i < processes; ++i) {
+				for(int j = i + 1; j < processes; ++j) {
+					int pair[2];
+					if(::socketpair(AF_UNIX, SOCK_STREAM, 0, pair) != 0) {
+						closeAll();
+						throw std::runtime_error(std::string("socketpair failed: ") + std::strerror(errno));
+					}
+					sockets[i][j] = pair[0];
+					sockets[j][i] = pair[1];
+				}
+			}
+
+			std::vector<pid_t> workers;
+			int forkError = 0;
+			for(int rank = 1; rank < processes; ++rank) {
+				pid_t pid = ::fork();
+				if(pid < 0) {
+					forkError = errno;
+					break;
+				}
+
+				if(pid == 0) {
+					// Keep only this rank's sockets
+					for(int i = 0; i < processes; ++i) {
+						if(i == rank)
+							continue;
+						for(int socket : sockets[i]) {
+							if(socket >= 0)
+								::close(socket);
+						}
+					}
+
+					// The parent's pool stays behind, this rank builds its own with one worker
+					ThreadPool::configureInstance(1, false);
+
+					int status = 0;
+					try {
+						SocketTransport transport(rank, sockets[rank]);
+						body(transport);
+					}
+					catch(const std::exception& e) {
+						std::cerr << "matrix: rank " << rank << " failed: " << e.what() << std::endl;
+						status = 1;
+					}
+					catch(...) {
+						status = 1;
+					}
+					// Skip static destructors, they belong to the parent
+					::_exit(status);
+				}
+				workers.push_back(pid);
+			}
+
+			// Keep rank 0's sockets, close the ends that went to the workers
+			std::vector<int> own = sockets[0];
+			for(int& socket : sockets[0])
+				socket = -1;
+			closeAll();
+
+			bool started = static_cast<int>(workers.size()) == processes - 1;
+			std::exception_ptr error;
+			if(started) {
+				try {
+					SocketTransport transport(0, own);
+					body(transport);
+				}
+				catch(...) {
+					error = std::current_exception();
+				}
+			}
+			else {
+				for(int socket : own) {
+					if(socket >= 0)
+						::close(socket);
+				}
+			}
+
+			// Rank 0's sockets are closed by now, so workers waiting on it fail and exit
+			bool failed = false;
+			for(pid_t pid : workers) {
+				int status = 0;
+				while(::waitpid(pid, &status, 0) < 0 && errno == EINTR);
+				if(!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+					failed = true;
+			}
+
+			if(error)
+				std::rethrow_exception(error);
+			if(!started)
+				throw std::runtime_error(std::string("fork failed: ") + std::strerror(forkError));
+			if(failed)
+				throw std::runtime_error("a distributed worker process failed");
+		}
+	}
+}
@@ -0,0 +1,40 @@
+#!/bin/bash
+##
+#	@file		bench_build.sh
+#	@brief	  Compare compile time and object size with and without extern templates
+#
+#	Compiles every test program twice: once linking against the instantiations
+#	in the library, and once with MATRIX_NO_EXTERN_TEMPLATES so each translation
+#	unit instantiates them itself.  Run from the repository root after cmake has
+#	gathered the headers into include/, or pass the include directory to use.
+#
+#	@author		Gabriel Shelton		sheltongabe
+#	@date		  10-19-2026
+#	@version	0.1
+#
+
+set -e
+
+INCLUDE_DIR=${1:-include}
+CXX=${CXX:-c++}
+FLAGS="-std=c++17 -O2 -pthread -I${INCLUDE_DIR}"
+OUT=$(mktemp -d)
+trap 'rm -rf "${OUT}"' EXIT
+
+# compile <label> <extra flags>: print seconds and text bytes over all tests
+compile() {
+	local label=$1 extra=$2 text=0
+	local start=$(date +%s.%N)
+	for source in test/src/test_*.cpp; do
+		${CXX} ${FLAGS} ${extra} -c "${source}" -o "${OUT}/$(basename "${source}" .cpp).o"
+	done
+	local end=$(date +%s.%N)
+	for object in "${OUT}"/*.o; do
+		text=$((text + $(size "${object}" | awk 'NR == 2 { print $1 }')))
+	done
+	printf "%-24s %8.2fs %10d bytes of code\n" "${label}" "$(awk "BEGIN { print ${end} - ${start} }")" "${text}"
+	rm -f "${OUT}"/*.o
+}
+
+compile "instantiated locally" "-DMATRIX_NO_EXTERN_TEMPLATES"
+compile "extern templates" ""
@@ -0,0 +1,74 @@
+/**
+ *  @file		bench_accumulator.cpp
+ *  @brief	  Report how summing from many threads scales against a mutex
+ *
+ * 	Each writer thread adds the same number of partial results, either into
+ * 	one matrix with operator+= under a mutex, or into an Accumulator.  Times
+ * 	include merging the accumulator's buffers.
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-19-2026
+ *  @version	0.1
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "matrix/accumulator.h"
+
+using matrix::Matrix;
+using matrix::Accumulator;
+using Clock = std::chrono::steady_clock;
+
+/// Size of the accumulated matrices
+constexpr int SIZE = 256;
+
+/// Partial results each writer adds
+constexpr int ADDS = 16;
+
+/// Run body(writer) on writers threads and return the seconds taken
+template <typename Body>
+double time(int writers, Body body) {
+	auto start = Clock::now();
+	std::vector<std::thread> threads;
+	for(int writer = 0; writer < writers; ++writer)
+		threads.emplace_back([&body, writer] () { body(writer); });
+	for(auto& thread : threads)
+		thread.join();
+	return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+/// Entry point into the code
+int main() {
+	const Matrix<SIZE, SIZE, double> partial(0.25);
+
+	std::cout << std::fixed << std::setprecision(4);
+	for(int writers : {1, 2, 4, 8, 16, 32, 64}) {
+		Matrix<SIZE, SIZE, double> shared(0.0);
+		std::mutex mutex;
+		double locked = time(writers, [&] (int) {
+			for(int add = 0; add < ADDS; ++add) {
+				std::lock_guard<std::mutex> lock(mutex);
+				shared += partial;
+			}
+		});
+
+		auto start = Clock::now();
+		Accumulator<SIZE, SIZE, double> accumulator(writers);
+		time(writers, [&] (int writer) {
+			for(int add = 0; add < ADDS; ++add)
+				accumulator.add(writer, partial);
+		});
+		Matrix<SIZE, SIZE, double> sum = accumulator.result();
+		double accumulated = std::chrono::duration<double>(Clock::now() - start).count();
+
+		std::cout << writers << " writers: mutex " << locked << "s, accumulator " << accumulated
+				<< "s, speedup " << locked / accumulated << (sum == shared ? "" : ", MISMATCH") << std::endl;
+	}
+
+	return 0;
+}
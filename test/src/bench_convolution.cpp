@@ -0,0 +1,108 @@
+/**
+ *  @file		bench_convolution.cpp
+ *  @brief	  Report how each convolution method compares to the naive loop
+ *
+ * 	Times a naive six deep loop, then every method that applies, on a 3x3
+ * 	CNN layer, a large single channel filter, and a strided 5x5 layer.
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-19-2026
+ *  @version	0.1
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "matrix/convolution.h"
+
+using matrix::Matrix;
+using matrix::ConvolutionMethod;
+using Clock = std::chrono::steady_clock;
+
+/// Correlate the plain way, one output at a time
+template <int S, int P, int D, int M, int N, int KH, int KW, typename T>
+std::vector<matrix::Convolved<M, N, KH, KW, S, P, D, T>> naive(const std::vector<Matrix<M, N, T>>& input,
+		const std::vector<std::vector<Matrix<KH, KW, T>>>& filters) {
+	constexpr int OM = matrix::convolvedSize(M, KH, S, P, D), ON = matrix::convolvedSize(N, KW, S, P, D);
+	std::vector<Matrix<OM, ON, T>> output(filters.size());
+	for(std::size_t o = 0; o < filters.size(); ++o) {
+		for(int y = 0; y < OM; ++y) {
+			for(int x = 0; x < ON; ++x) {
+				T sum = T();
+				for(std::size_t c = 0; c < input.size(); ++c) {
+					for(int i = 0; i < KH; ++i) {
+						for(int j = 0; j < KW; ++j) {
+							int row = y * S - P + i * D, column = x * S - P + j * D;
+							if(row >= 0 && row < M && column >= 0 && column < N)
+								sum += input[c][row][column] * filters[o][c][i][j];
+						}
+					}
+				}
+				output[o][y][x] = sum;
+			}
+		}
+	}
+	return output;
+}
+
+/// Time every method on one layer and print it beside the naive loop
+template <int S, int P, int D, int M, int N, int KH, int KW>
+void run(const std::string& name, int channels, int outputs) {
+	std::vector<Matrix<M, N, double>> input(channels);
+	for(int c = 0; c < channels; ++c) {
+		for(int i = 0; i < M; ++i)
+			for(int j = 0; j < N; ++j)
+				input[c][i][j] = std::sin(i * 0.01 + j * 0.02 + c);
+	}
+	std::vector<std::vector<Matrix<KH, KW, double>>> filters(outputs,
+			std::vector<Matrix<KH, KW, double>>(channels));
+	for(int o = 0; o < outputs; ++o) {
+		for(int c = 0; c < channels; ++c)
+			for(int i = 0; i < KH; ++i)
+				for(int j = 0; j < KW; ++j)
+					filters[o][c][i][j] = std::cos(o + c * 0.5 + i * 0.3 - j * 0.2);
+	}
+
+	auto start = Clock::now();
+	auto expected = naive<S, P, D>(input, filters);
+	double baseline = std::chrono::duration<double>(Clock::now() - start).count();
+
+	std::cout << std::fixed << std::setprecision(4);
+	std::cout << name << std::endl << "  naive:    " << baseline << "s" << std::endl;
+
+	const std::pair<ConvolutionMethod, const char*> METHODS[] = {
+		{ConvolutionMethod::Direct, "direct:   "},
+		{ConvolutionMethod::Im2col, "im2col:   "},
+		{ConvolutionMethod::Winograd, "winograd: "}
+	};
+	for(const auto& method : METHODS) {
+		if(method.first == ConvolutionMethod::Winograd && !(KH == 3 && KW == 3 && S == 1 && D == 1))
+			continue;
+
+		start = Clock::now();
+		auto result = matrix::correlate2d<S, P, D>(input, filters, method.first);
+		double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+		double error = 0.0;
+		for(int o = 0; o < outputs; ++o)
+			for(int i = 0; i < result[o].getHeight(); ++i)
+				for(int j = 0; j < result[o].getWidth(); ++j)
+					error = std::max(error, std::abs(result[o][i][j] - expected[o][i][j]));
+
+		std::cout << "  " << method.second << seconds << "s, speedup " << baseline / seconds
+				<< ", max error " << std::scientific << error << std::fixed << std::endl;
+	}
+}
+
+/// Entry point into the code
+int main() {
+	run<1, 1, 1, 128, 128, 3, 3>("3x3, 16 -> 16 channels, 128 x 128", 16, 16);
+	run<1, 3, 1, 512, 512, 7, 7>("7x7, 1 channel, 512 x 512", 1, 1);
+	run<2, 2, 1, 128, 128, 5, 5>("5x5 stride 2, 8 -> 32 channels, 128 x 128", 8, 32);
+
+	return 0;
+}
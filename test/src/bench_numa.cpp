@@ -0,0 +1,109 @@
+/**
+ *  @file		bench_numa.cpp
+ *  @brief	  Entry for the benchmark of memory bandwidth per NUMA node
+ *
+ * 	Reads a large matrix from every worker, once after a serial first touch
+ * 	and once after the parallel first touch the Matrix constructor performs,
+ * 	and reports the bandwidth each node achieved.
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-19-2026
+ *  @version	0.1
+ */
+
+#include <iostream>
+#include <chrono>
+#include <limits>
+#include <map>
+#include <memory>
+
+#include "matrix/matrix.h"
+
+using matrix::Matrix;
+using matrix::ThreadPool;
+using matrix::KernelConfig;
+
+/// Rows of the benchmarked matrix
+static const int ROWS = 8192;
+
+/// Columns of the benchmarked matrix, 64 MiB of doubles in total
+static const int COLUMNS = 1024;
+
+/// Number of passes over each worker's rows
+static const int PASSES = 5;
+
+/// Read every worker's rows in parallel, and report the bandwidth per node
+void measure(const char* label, const Matrix<ROWS, COLUMNS, double>& m) {
+	ThreadPool& pool = ThreadPool::getInstance();
+	int workers = pool.size();
+	std::vector<double> seconds(workers);
+	std::vector<double> sums(workers);
+
+	// Same partition of the rows as parallelFor() uses
+	std::vector<std::future<void>> pending;
+	for(int worker = 0; worker < workers; ++worker) {
+		int begin = static_cast<long long>(ROWS) * worker / workers;
+		int end = static_cast<long long>(ROWS) * (worker + 1) / workers;
+		pending.push_back(pool.submitTo(worker, [&, worker, begin, end] () {
+			auto start = std::chrono::steady_clock::now();
+			double sum = 0.0;
+			for(int pass = 0; pass < PASSES; ++pass) {
+				for(int row = begin; row < end; ++row) {
+					const double* values = m[row].data();
+					for(int column = 0; column < COLUMNS; ++column)
+						sum += values[column];
+				}
+			}
+			std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+			seconds[worker] = elapsed.count();
+			sums[worker] = sum;
+		}));
+	}
+	for(auto& future : pending)
+		future.get();
+
+	// Combine the workers of each node
+	std::map<int, std::pair<double, double>> nodes;
+	for(int worker = 0; worker < workers; ++worker) {
+		int rows = static_cast<long long>(ROWS) * (worker + 1) / workers -
+				static_cast<long long>(ROWS) * worker / workers;
+		double bytes = static_cast<double>(rows) * COLUMNS * sizeof(double) * PASSES;
+		auto& node = nodes[pool.getWorkerNode(worker)];
+		node.first += bytes / seconds[worker];
+		node.second += sums[worker];
+	}
+
+	std::cout << label << std::endl;
+	for(const auto& node : nodes)
+		std::cout << "\tnode " << node.first << ": " << node.second.first / 1e9 << " GB/s" << std::endl;
+}
+
+/// Entry point into the code
+int main() {
+	ThreadPool& pool = ThreadPool::getInstance();
+	std::cout << pool.size() << " workers:";
+	for(unsigned int worker = 0; worker < pool.size(); ++worker)
+		std::cout << " cpu " << pool.getWorkerCpu(worker) << " (node " << pool.getWorkerNode(worker) << ")";
+	std::cout << std::endl;
+
+	KernelConfig& config = KernelConfig::getInstance();
+	long threshold = config.getElementwiseThreshold();
+
+	// ----- Serial first touch: every page lands on the calling thread's node -----
+	{
+		config.setElementwiseThreshold(std::numeric_limits<long>::max());
+		auto m = std::make_unique<Matrix<ROWS, COLUMNS, double>>(1.0);
+		config.setElementwiseThreshold(threshold);
+		measure("serial first touch", *m);
+	}
+
+	// ----- Parallel first touch: pages land beside the workers that read them -----
+	{
+		config.setElementwiseThreshold(1);
+		auto m = std::make_unique<Matrix<ROWS, COLUMNS, double>>(1.0);
+		config.setElementwiseThreshold(threshold);
+		measure("parallel first touch", *m);
+	}
+
+	return 0;
+}
@@ -0,0 +1,85 @@
+/**
+ *  @file		bench_summa.cpp
+ *  @brief	  Report how distributed multiplication scales with local processes
+ *
+ * 	Times the single process kernel on one thread, then SUMMA on 1, 2, 4 and
+ * 	8 forked workers, each single threaded.  Every rank builds and checks only
+ * 	its own blocks, as a real distributed run would.  Times include forking
+ * 	the workers.
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-19-2026
+ *  @version	0.1
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cmath>
+#include <climits>
+
+#include "matrix/distributed.h"
+
+using matrix::Matrix;
+using matrix::KernelConfig;
+using Clock = std::chrono::steady_clock;
+
+/// Size of the benchmarked matrices
+constexpr int SIZE = 768;
+
+/// Entry point into the code
+int main() {
+	Matrix<SIZE, SIZE, double> A, B;
+	for(int i = 0; i < SIZE; ++i) {
+		for(int j = 0; j < SIZE; ++j) {
+			A[i][j] = std::sin(i * 0.01 + j * 0.02);
+			B[i][j] = std::cos(i * 0.03 - j * 0.01);
+		}
+	}
+
+	// Single process, single thread, then back to the loaded cutoff
+	KernelConfig& config = KernelConfig::getInstance();
+	long threshold = config.getGemmThreshold();
+	config.setGemmThreshold(LONG_MAX);
+	auto start = Clock::now();
+	Matrix<SIZE, SIZE, double> expected = A * B;
+	double baseline = std::chrono::duration<double>(Clock::now() - start).count();
+	config.setGemmThreshold(threshold);
+
+	std::cout << std::fixed << std::setprecision(3);
+	std::cout << "single process: " << baseline << "s" << std::endl;
+
+	for(int processes : {1, 2, 4, 8}) {
+		matrix::distributed::ProcessGrid grid = matrix::distributed::ProcessGrid::square(processes);
+		double error = 0.0;
+
+		start = Clock::now();
+		matrix::distributed::runLocal(processes, [&] (matrix::distributed::Transport& transport) {
+			double local = 0.0;
+			matrix::distributed::multiplyBlocks<double>(transport, grid, SIZE, SIZE, SIZE,
+					[&A] (int row, int column) { return A[row][column]; },
+					[&B] (int row, int column) { return B[row][column]; },
+					[&] (int row, int column, double value) {
+				local = std::max(local, std::abs(value - expected[row][column]));
+			});
+
+			// Rank 0 collects the largest error of every rank
+			if(transport.rank() != 0) {
+				transport.send(0, &local, sizeof(local));
+				return;
+			}
+			error = local;
+			for(int rank = 1; rank < transport.size(); ++rank) {
+				transport.receive(rank, &local, sizeof(local));
+				error = std::max(error, local);
+			}
+		});
+		double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+		std::cout << processes << " processes: " << seconds << "s, speedup "
+				<< baseline / seconds << ", max error " << std::scientific << error
+				<< std::fixed << std::endl;
+	}
+
+	return 0;
+}
@@ -0,0 +1,161 @@
+/**
+ *  @file		test_accumulator.cpp
+ *  @brief	  Entry for test-cases that test concurrent accumulation
+ *
+ * 	Test that many threads sum into one matrix correctly, and reproducibly
+ * 	when they use their own buffers
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-19-2026
+ *  @version	0.1
+ */
+
+#include <iostream>
+#include <cmath>
+#include <thread>
+#include <vector>
+#include <stdexcept>
+
+#include "matrix/accumulator.h"
+#include "matrix/thread_pool.h"
+
+using matrix::Matrix;
+using matrix::Accumulator;
+
+/// Partial result of a writer, with values that round differently by order
+template <int M, int N>
+Matrix<M, N, double> partial(int writer) {
+	Matrix<M, N, double> m;
+	for(int i = 0; i < M; ++i) {
+		for(int j = 0; j < N; ++j)
+			m[i][j] = std::sin(writer * 1.7 + i * 0.3 + j * 0.11) * std::pow(10.0, writer % 7);
+	}
+	return m;
+}
+
+/// Run body(writer) on one thread per writer, started in the given order
+template <typename Body>
+void runWriters(int writers, bool reversed, Body body) {
+	std::vector<std::thread> threads;
+	for(int i = 0; i < writers; ++i) {
+		int writer = reversed ? writers - 1 - i : i;
+		threads.emplace_back([&body, writer] () { body(writer); });
+	}
+	for(auto& thread : threads)
+		thread.join();
+}
+
+/// Entry point into the code
+int main() {
+
+	// ----- Integer sums from many threads -----
+	{
+		constexpr int WRITERS = 64;
+		Accumulator<5, 9, int> accumulator(WRITERS);
+		runWriters(WRITERS, false, [&accumulator] (int writer) {
+			Matrix<5, 9, int> m(writer);
+			for(int repeat = 0; repeat < 10; ++repeat)
+				accumulator.add(writer, m);
+			accumulator.addAt(writer, 4, 8, 1);
+		});
+
+		Matrix<5, 9, int> sum = accumulator.result();
+		int expected = 10 * (WRITERS * (WRITERS - 1) / 2);
+		for(int i = 0; i < 5; ++i) {
+			for(int j = 0; j < 9; ++j) {
+				if(sum[i][j] != expected + (i == 4 && j == 8 ? WRITERS : 0))
+					return 1;
+			}
+		}
+
+		// Reset zeroes everything, but the buffers stay usable
+		accumulator.reset();
+		if(accumulator.result() != Matrix<5, 9, int>(0))
+			return 1;
+		accumulator.add(3, Matrix<5, 9, int>(2));
+		if(accumulator.result() != Matrix<5, 9, int>(2))
+			return 1;
+	}
+
+	// ----- Reproducible floating point sums -----
+	{
+		constexpr int WRITERS = 13;
+		auto run = [] (bool reversed) {
+			Accumulator<7, 33, double> accumulator(WRITERS);
+			runWriters(WRITERS, reversed, [&accumulator] (int writer) {
+				accumulator.add(writer, partial<7, 33>(writer));
+			});
+			return accumulator.result();
+		};
+
+		Matrix<7, 33, double> first = run(false);
+		for(int attempt = 0; attempt < 5; ++attempt) {
+			if(run(attempt % 2 == 0) != first)
+				return 1;
+		}
+
+		// Pairwise in writer order, ((0 + 1) + (2 + 3)) + ... with 12 carried up
+		std::vector<Matrix<7, 33, double>> level;
+		for(int writer = 0; writer < WRITERS; ++writer)
+			level.push_back(partial<7, 33>(writer));
+		while(level.size() > 1) {
+			std::vector<Matrix<7, 33, double>> next;
+			for(std::size_t i = 0; i + 1 < level.size(); i += 2) {
+				Matrix<7, 33, double> pair = level[i];
+				pair += level[i + 1];
+				next.push_back(pair);
+			}
+			if(level.size() % 2 == 1)
+				next.push_back(level.back());
+			level = std::move(next);
+		}
+		if(first != level[0])
+			return 1;
+	}
+
+	// ----- Writers on the ThreadPool, some never adding -----
+	{
+		Accumulator<64, 64, double> accumulator(16);
+		matrix::ThreadPool::getInstance().parallelFor(0, 8, [&accumulator] (int begin, int end) {
+			for(int writer = begin; writer < end; ++writer)
+				accumulator.add(writer * 2, Matrix<64, 64, double>(0.5));
+		});
+		if(accumulator.result() != Matrix<64, 64, double>(4.0))
+			return 1;
+	}
+
+	// ----- Scattered updates through the striped shared matrix -----
+	{
+		constexpr int WRITERS = 64;
+		Accumulator<100, 10, int> accumulator(1);
+		runWriters(WRITERS, false, [&accumulator] (int writer) {
+			for(int k = 0; k < 1000; ++k)
+				accumulator.addAt((writer * 7 + k) % 100, k % 10, 1);
+		});
+		accumulator.add(0, Matrix<100, 10, int>(5));
+
+		Matrix<100, 10, int> sum = accumulator.result();
+		long total = 0;
+		for(int i = 0; i < 100; ++i) {
+			for(int j = 0; j < 10; ++j)
+				total += sum[i][j] - 5;
+		}
+		if(total != WRITERS * 1000)
+			return 1;
+	}
+
+	// ----- Invalid arguments -----
+	{
+		Accumulator<2, 2, int> accumulator(2);
+		int thrown = 0;
+		try { accumulator.buffer(2); } catch(std::out_of_range&) { ++thrown; }
+		try { accumulator.addAt(-1, 0, 0, 1); } catch(std::out_of_range&) { ++thrown; }
+		try { accumulator.addAt(0, 2, 0, 1); } catch(std::out_of_range&) { ++thrown; }
+		try { accumulator.addAt(0, 0, 2, 1); } catch(std::out_of_range&) { ++thrown; }
+		try { Accumulator<2, 2, int> none(0); } catch(std::invalid_argument&) { ++thrown; }
+		if(thrown != 5)
+			return 1;
+	}
+
+	return 0;
+}
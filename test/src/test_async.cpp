@@ -0,0 +1,283 @@
+/**
+ *  @file		test_async.cpp
+ *  @brief	  Entry for test-cases that test the asynchronous matrix operations
+ *
+ * 	Test chaining, joining, errors and cancellation of tasks
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-19-2026
+ *  @version	0.1
+ */
+
+#include <iostream>
+#include <chrono>
+#include <future>
+#include <vector>
+#include <thread>
+#include <memory>
+#include <atomic>
+#include <algorithm>
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+#include "matrix/async.h"
+
+using matrix::Matrix;
+using matrix::Task;
+
+/// Bit i is set once worker i has multiplied a Traced
+static std::atomic<unsigned long> workersSeen(0);
+
+/// Number that records which workers multiply it
+struct Traced {
+	double value = 1.0;
+
+	Traced operator * (const Traced& rhs) const {
+		int worker = matrix::ThreadPool::currentWorker();
+		if(worker >= 0)
+			workersSeen |= 1UL << (worker % 64);
+		return Traced { this->value * rhs.value };
+	}
+
+	Traced& operator += (const Traced& rhs) {
+		this->value += rhs.value;
+		return *this;
+	}
+
+	/// Stored in JSON as the double
+	operator double() const { return this->value; }
+};
+
+/// Entry point into the code
+int main() {
+
+	// ----- Multiply on the pool -----
+	{
+		Task<Matrix<3, 3, int>> product = matrix::multiplyAsync(
+				Matrix<3, 3, int>(2), Matrix<3, 3, int>(3));
+		if(product.get() != Matrix<3, 3, int>(18))
+			return 1;
+	}
+
+	// ----- Chain dependent operations -----
+	{
+		auto a = matrix::multiplyAsync(Matrix<2, 2, int>(1), Matrix<2, 2, int>(1));
+		auto b = matrix::multiplyAsync(Matrix<2, 2, int>(2), Matrix<2, 2, int>(1));
+		auto c = matrix::multiplyAsync(a, b);
+		auto text = c.then([] (const Matrix<2, 2, int>& m) {
+			return static_cast<std::string>(m);
+		});
+
+		if(c.get() != Matrix<2, 2, int>(16) || text.get().empty())
+			return 1;
+	}
+
+	// ----- Errors flow through the chain -----
+	{
+		auto failed = matrix::runAsync([] () -> int {
+			throw std::out_of_range("expected");
+		});
+		auto next = failed.then([] (const int& value) { return value + 1; });
+
+		try {
+			next.get();
+			return 1;
+		}
+		catch(const std::out_of_range&) { }
+	}
+
+	// ----- Cancellation before the task runs -----
+	{
+		matrix::CancellationToken token;
+		token.cancel();
+		auto cancelled = matrix::multiplyAsync(Matrix<2, 2, int>(1), Matrix<2, 2, int>(1), token);
+		auto dependent = cancelled.then([] (const Matrix<2, 2, int>& m) { return m.size(); });
+
+		try {
+			dependent.get();
+			return 1;
+		}
+		catch(const matrix::OperationCancelled&) { }
+	}
+
+	// ----- Cancelling a branch leaves its input and sibling branches running -----
+	{
+		std::promise<void> gate;
+		std::shared_future<void> opened = gate.get_future().share();
+		auto input = matrix::runAsync([opened] () {
+			opened.wait();
+			return 3;
+		});
+		auto cancelled = input.then([] (const int& value) { return value + 1; });
+		auto sibling = input.then([] (const int& value) { return value * 2; });
+		auto downstream = cancelled.then([] (const int& value) { return value - 1; });
+
+		cancelled.cancel();
+		gate.set_value();
+
+		if(input.getToken().isCancelled() || sibling.getToken().isCancelled()
+				|| !downstream.getToken().isCancelled())
+			return 1;
+		if(input.get() != 3 || sibling.get() != 6)
+			return 1;
+		try {
+			downstream.get();
+			return 1;
+		}
+		catch(const matrix::OperationCancelled&) { }
+	}
+
+	// ----- Pool placement: chunk i of parallelFor runs on worker i -----
+	{
+		// Nothing is taken from a worker that is merely slow to be scheduled
+		matrix::ThreadPool pool(4, true, std::chrono::seconds(60));
+		std::vector<int> covered(1000, 0);
+		pool.parallelFor(0, 1000, [&] (int begin, int end) {
+			for(int i = begin; i < end; ++i)
+				++covered[i];
+		});
+		for(int count : covered)
+			if(count != 1)
+				return 1;
+
+		// Each chunk records the worker and CPU it ran on
+		std::vector<int> worker(4, -2), cpu(4, -2);
+		pool.parallelFor(0, 4, [&] (int begin, int) {
+			worker[begin] = matrix::ThreadPool::currentWorker();
+#ifdef __linux__
+			cpu[begin] = sched_getcpu();
+#endif
+		});
+		for(int chunk = 0; chunk < 4; ++chunk) {
+			if(worker[chunk] != chunk)
+				return 1;
+#ifdef __linux__
+			if(pool.getWorkerCpu(chunk) != -1 && cpu[chunk] != pool.getWorkerCpu(chunk))
+				return 1;
+#endif
+		}
+
+		auto onWorker = pool.submitTo(2, [] () { return matrix::ThreadPool::currentWorker(); });
+		if(onWorker.get() != 2 || matrix::ThreadPool::currentWorker() != -1)
+			return 1;
+	}
+
+	// ----- Placement is a preference, a busy worker doesn't stall parallelFor -----
+	{
+		matrix::ThreadPool pool(4, true);
+		std::promise<void> release;
+		std::promise<int> started;
+		std::shared_future<void> released = release.get_future().share();
+		auto blocked = pool.submitTo(1, [released, &started] () {
+			started.set_value(matrix::ThreadPool::currentWorker());
+			released.wait_for(std::chrono::seconds(10));
+		});
+
+		// Meant for worker 1, but under load another may have taken it first
+		int busyWorker = started.get_future().get();
+
+		// The busy worker's chunk is taken over by another worker or this thread
+		std::vector<int> worker(4, -2);
+		pool.parallelFor(0, 4, [&] (int begin, int) {
+			worker[begin] = matrix::ThreadPool::currentWorker();
+		});
+		bool finishedFirst = blocked.wait_for(std::chrono::seconds(0)) != std::future_status::ready;
+		release.set_value();
+		blocked.get();
+		if(!finishedFirst || worker[busyWorker] == busyWorker)
+			return 1;
+
+		// Every worker busy, the calling thread runs the chunks itself
+		std::promise<void> releaseAll;
+		std::shared_future<void> allReleased = releaseAll.get_future().share();
+		std::vector<std::future<void>> busy;
+		for(unsigned int i = 0; i < pool.size(); ++i)
+			busy.push_back(pool.submitTo(i, [allReleased] () {
+				allReleased.wait_for(std::chrono::seconds(10));
+			}));
+		std::vector<int> covered(100, 0);
+		pool.parallelFor(0, 100, [&] (int begin, int end) {
+			for(int i = begin; i < end; ++i)
+				++covered[i];
+		});
+		releaseAll.set_value();
+		for(auto& future : busy)
+			future.get();
+		for(int count : covered)
+			if(count != 1)
+				return 1;
+	}
+
+	// ----- parallelFor from a worker fans out to the idle workers -----
+	{
+		matrix::ThreadPool pool(4);
+		std::vector<int> worker(4, -2);
+		pool.submit([&] () {
+			pool.parallelFor(0, 4, [&] (int begin, int) {
+				worker[begin] = matrix::ThreadPool::currentWorker();
+				std::this_thread::sleep_for(std::chrono::milliseconds(100));
+			});
+		}).get();
+
+		int distinct = 0;
+		for(int chunk = 0; chunk < 4; ++chunk) {
+			if(worker[chunk] < 0)
+				return 1;
+			distinct += std::count(worker.begin(), worker.begin() + chunk, worker[chunk]) == 0;
+		}
+		if(distinct < 2)
+			return 1;
+	}
+
+	// ----- An async product uses more than one worker -----
+	if(matrix::ThreadPool::getInstance().size() > 1) {
+		matrix::KernelConfig& config = matrix::KernelConfig::getInstance();
+		long threshold = config.getGemmThreshold();
+		int block = config.getGemmBlockSize();
+		config.setGemmThreshold(1);
+		config.setGemmBlockSize(8);
+		workersSeen = 0;
+		auto product = matrix::multiplyAsync(Matrix<256, 64, Traced>(), Matrix<64, 64, Traced>());
+		product.wait();
+		config.setGemmThreshold(threshold);
+		config.setGemmBlockSize(block);
+
+		unsigned long seen = workersSeen;
+		if((seen & (seen - 1)) == 0)
+			return 1;
+	}
+
+	// ----- A running product stops once cancelled -----
+	{
+		auto a = std::make_unique<Matrix<2048, 2048, double>>(1.0);
+		auto b = std::make_unique<Matrix<2048, 2048, double>>(1.0);
+		matrix::CancellationToken token;
+		std::thread canceller([token] () {
+			std::this_thread::sleep_for(std::chrono::milliseconds(20));
+			token.cancel();
+		});
+		bool stopped = false;
+		try {
+			matrix::multiply(*a, *b, token);
+		}
+		catch(const matrix::OperationCancelled&) {
+			stopped = true;
+		}
+		canceller.join();
+		if(!stopped)
+			return 1;
+	}
+
+	// ----- Serialization -----
+	{
+		auto text = matrix::toStringAsync(Matrix<2, 2, int>(5));
+		auto json = matrix::toJSONAsync(Matrix<2, 2, int>(5));
+		if(text.get() != static_cast<std::string>(Matrix<2, 2, int>(5)))
+			return 1;
+		json.wait();
+	}
+
+	return 0;
+}
@@ -0,0 +1,150 @@
+/**
+ *  @file		test_comparison.cpp
+ *  @brief	  Entry for test-cases that test equality, approximate comparison and hashing
+ *
+ * 	Test exact and tolerance based comparison, and that equal matrices hash equal
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-19-2026
+ *  @version	0.1
+ */
+
+#include <iostream>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <unordered_set>
+
+#include "matrix/comparison.h"
+#include "matrix/hash.h"
+
+using matrix::Matrix;
+using matrix::Tolerance;
+
+/// Trivially copyable value whose equality ignores the last digit
+struct Coarse {
+	int value;
+
+	bool operator == (const Coarse& rhs) const { return this->value / 10 == rhs.value / 10; }
+	bool operator != (const Coarse& rhs) const { return !(*this == rhs); }
+
+	/// Stored in JSON as the int
+	operator int() const { return this->value; }
+};
+
+/// Entry point into the code
+int main() {
+
+	// ----- Exact equality -----
+	{
+		Matrix<3, 37, int> a(4), b(4);
+		if(a != b)
+			return 1;
+		b[2][36] = 5;
+		if(a == b)
+			return 1;
+
+		Matrix<2, 40, double> x(1.5), y(1.5);
+		y[1][17] = -0.0;
+		x[1][17] = 0.0;
+		if(x != y)
+			return 1;
+		x[0][39] = std::numeric_limits<double>::quiet_NaN();
+		y[0][39] = x[0][39];
+		if(x == y)
+			return 1;
+	}
+
+	// ----- Equality uses T's operator== for class types -----
+	{
+		Matrix<2, 20, Coarse> a, b;
+		for(int i = 0; i < 2; ++i) {
+			for(int j = 0; j < 20; ++j) {
+				a[i][j].value = 10 * j + 1;
+				b[i][j].value = 10 * j + 9;
+			}
+		}
+		if(a != b)
+			return 1;
+		b[1][19].value = 0;
+		if(a == b)
+			return 1;
+	}
+
+	// ----- Approximate equality -----
+	{
+		Matrix<2, 2, double> a(1.0), b(1.0);
+		b[1][1] = 1.0 + 1e-10;
+		if(!matrix::approxEqual<Tolerance::Absolute>(a, b, 1e-9)
+				|| matrix::approxEqual<Tolerance::Absolute>(a, b, 1e-11))
+			return 1;
+		if(!matrix::approxEqual(a, b, 1e-9) || matrix::approxEqual(a, b, 1e-11))
+			return 1;
+
+		// Neighbouring doubles are one ulp apart, and +0 and -0 none
+		b[1][1] = std::nextafter(1.0, 2.0);
+		if(!matrix::approxEqual<Tolerance::Ulps>(a, b, 1) || matrix::approxEqual<Tolerance::Ulps>(a, b, 0))
+			return 1;
+		if(matrix::ulpDistance(0.0, -0.0) != 0 || matrix::ulpDistance(-1.0f, std::nextafter(-1.0f, 0.0f)) != 1)
+			return 1;
+		if(matrix::ulpDistance(-std::numeric_limits<double>::denorm_min(), std::numeric_limits<double>::denorm_min()) != 2)
+			return 1;
+
+		// NaN never matches, infinities only themselves
+		b[1][1] = std::numeric_limits<double>::quiet_NaN();
+		if(matrix::approxEqual<Tolerance::Absolute>(a, b, 1e300))
+			return 1;
+		a[0][0] = b[0][0] = std::numeric_limits<double>::infinity();
+		b[1][1] = 1.0;
+		if(!matrix::approxEqual(a, b, 0.0))
+			return 1;
+
+		// Integers far apart don't overflow
+		if(matrix::ulpDistance(std::numeric_limits<int>::min(), std::numeric_limits<int>::max()) != 0xFFFFFFFFull)
+			return 1;
+		if(matrix::ulpDistance(std::numeric_limits<long long>::max(), std::numeric_limits<long long>::min())
+				!= std::numeric_limits<std::uint64_t>::max())
+			return 1;
+
+		Matrix<2, 3, int> i(7), j(7);
+		j[0][2] = 9;
+		if(!matrix::approxEqual<Tolerance::Ulps>(i, j, 2) || matrix::approxEqual<Tolerance::Absolute>(i, j, 1))
+			return 1;
+	}
+
+	// ----- Content hashing -----
+	{
+		// Known XXH64 digests
+		matrix::ContentHasher empty;
+		if(empty.digest() != 0xEF46DB3751D8E999ULL)
+			return 1;
+		const char* text = "Nobody inspects the spammish repetition";
+		matrix::ContentHasher whole, pieces;
+		whole.update(text, std::strlen(text));
+		pieces.update(text, 5);
+		pieces.update(text + 5, 30);
+		pieces.update(text + 35, std::strlen(text) - 35);
+		if(whole.digest() != 0xFBCEA83C8A378BF1ULL || pieces.digest() != whole.digest())
+			return 1;
+
+		// Equal matrices hash equal, including +0 and -0
+		Matrix<5, 70, double> a(2.0), b(2.0);
+		a[3][3] = 0.0;
+		b[3][3] = -0.0;
+		if(matrix::hash(a) != matrix::hash(b))
+			return 1;
+		b[4][69] = 2.5;
+		if(matrix::hash(a) == matrix::hash(b) || matrix::hash(a, 1) == matrix::hash(a))
+			return 1;
+
+		// Dedupe in a hash set
+		std::unordered_set<Matrix<2, 2, int>> seen;
+		seen.insert(Matrix<2, 2, int>(1));
+		seen.insert(Matrix<2, 2, int>(2));
+		seen.insert(Matrix<2, 2, int>(1));
+		if(seen.size() != 2 || !seen.count(Matrix<2, 2, int>(2)))
+			return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,204 @@
+/**
+ *  @file		test_convolution.cpp
+ *  @brief	  Entry for test-cases that test 2D convolution and correlation
+ *
+ * 	Test every method against a naive loop over strides, padding and dilation
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-19-2026
+ *  @version	0.1
+ */
+
+#include <iostream>
+#include <vector>
+#include <stdexcept>
+
+#include "matrix/convolution.h"
+#include "matrix/comparison.h"
+
+using matrix::Matrix;
+using matrix::ConvolutionMethod;
+using matrix::Tolerance;
+
+/// Fill a matrix with small values that differ by position and seed
+template <int M, int N, typename T>
+Matrix<M, N, T> pattern(int seed) {
+	Matrix<M, N, T> m;
+	for(int i = 0; i < M; ++i) {
+		for(int j = 0; j < N; ++j)
+			m[i][j] = static_cast<T>((i * 7 + j * 13 + seed * 5) % 11 - 5);
+	}
+	return m;
+}
+
+/// Correlate the plain way, one output at a time
+template <int S, int P, int D, int M, int N, int KH, int KW, typename T>
+std::vector<matrix::Convolved<M, N, KH, KW, S, P, D, T>> naive(const std::vector<Matrix<M, N, T>>& input,
+		const std::vector<std::vector<Matrix<KH, KW, T>>>& filters) {
+	constexpr int OM = matrix::convolvedSize(M, KH, S, P, D), ON = matrix::convolvedSize(N, KW, S, P, D);
+	std::vector<Matrix<OM, ON, T>> output(filters.size());
+	for(std::size_t o = 0; o < filters.size(); ++o) {
+		for(int y = 0; y < OM; ++y) {
+			for(int x = 0; x < ON; ++x) {
+				T sum = T();
+				for(std::size_t c = 0; c < input.size(); ++c) {
+					for(int i = 0; i < KH; ++i) {
+						for(int j = 0; j < KW; ++j) {
+							int row = y * S - P + i * D, column = x * S - P + j * D;
+							if(row >= 0 && row < M && column >= 0 && column < N)
+								sum += input[c][row][column] * filters[o][c][i][j];
+						}
+					}
+				}
+				output[o][y][x] = sum;
+			}
+		}
+	}
+	return output;
+}
+
+/// Build channels input channels and outputs x channels filters
+template <int M, int N, int KH, int KW, typename T>
+void build(int channels, int outputs, std::vector<Matrix<M, N, T>>& input,
+		std::vector<std::vector<Matrix<KH, KW, T>>>& filters) {
+	for(int c = 0; c < channels; ++c)
+		input.push_back(pattern<M, N, T>(c));
+	filters.resize(outputs);
+	for(int o = 0; o < outputs; ++o) {
+		for(int c = 0; c < channels; ++c)
+			filters[o].push_back(pattern<KH, KW, T>(o * channels + c + 3));
+	}
+}
+
+/// Check that the methods give exactly the naive result
+template <int S, int P, int D, int M, int N, int KH, int KW, typename T>
+bool exact(int channels, int outputs, std::initializer_list<ConvolutionMethod> methods) {
+	std::vector<Matrix<M, N, T>> input;
+	std::vector<std::vector<Matrix<KH, KW, T>>> filters;
+	build(channels, outputs, input, filters);
+
+	auto expected = naive<S, P, D>(input, filters);
+	for(ConvolutionMethod method : methods) {
+		auto result = matrix::correlate2d<S, P, D>(input, filters, method);
+		if(result.size() != expected.size())
+			return false;
+		for(std::size_t o = 0; o < result.size(); ++o) {
+			if(result[o] != expected[o])
+				return false;
+		}
+	}
+	return true;
+}
+
+/// Check that the methods give the naive result within a tolerance
+template <int S, int P, int D, int M, int N, int KH, int KW>
+bool close(int channels, int outputs, std::initializer_list<ConvolutionMethod> methods) {
+	std::vector<Matrix<M, N, double>> input;
+	std::vector<std::vector<Matrix<KH, KW, double>>> filters;
+	build(channels, outputs, input, filters);
+
+	auto expected = naive<S, P, D>(input, filters);
+	for(ConvolutionMethod method : methods) {
+		auto result = matrix::correlate2d<S, P, D>(input, filters, method);
+		for(std::size_t o = 0; o < result.size(); ++o) {
+			if(!matrix::approxEqual<Tolerance::Absolute>(result[o], expected[o], 1e-9))
+				return false;
+		}
+	}
+	return true;
+}
+
+/// Entry point into the code
+int main() {
+	const auto ALL_EXACT = {ConvolutionMethod::Auto, ConvolutionMethod::Direct, ConvolutionMethod::Im2col};
+	const auto ALL = {ConvolutionMethod::Auto, ConvolutionMethod::Direct,
+			ConvolutionMethod::Im2col, ConvolutionMethod::Winograd};
+
+	// ----- Output sizes -----
+	static_assert(matrix::convolvedSize(32, 3, 1, 1, 1) == 32, "same padding keeps the size");
+	static_assert(matrix::convolvedSize(31, 5, 2, 2, 2) == 14, "stride and dilation shrink the output");
+	static_assert(matrix::convolvedSize(4, 4, 3, 0, 1) == 1, "a kernel the size of the input gives one output");
+
+	// ----- Integer correlation, exact -----
+	if(!exact<1, 0, 1, 9, 11, 3, 3, int>(1, 1, ALL_EXACT))
+		return 1;
+	if(!exact<1, 1, 1, 13, 8, 3, 3, int>(3, 4, ALL_EXACT))
+		return 1;
+	if(!exact<2, 2, 2, 31, 29, 5, 5, int>(2, 3, ALL_EXACT))
+		return 1;
+	if(!exact<3, 1, 1, 17, 20, 2, 4, int>(2, 2, ALL_EXACT))
+		return 1;
+	if(!exact<1, 3, 1, 6, 7, 7, 7, int>(1, 2, ALL_EXACT))
+		return 1;
+
+	// ----- Floating point, including Winograd with odd output sizes -----
+	if(!close<1, 0, 1, 17, 23, 3, 3>(3, 4, ALL))
+		return 1;
+	if(!close<1, 1, 1, 16, 9, 3, 3>(2, 5, ALL))
+		return 1;
+	if(!close<1, 2, 1, 5, 5, 3, 3>(1, 1, ALL))
+		return 1;
+
+	// ----- Large enough to split across the ThreadPool -----
+	if(!close<1, 1, 1, 96, 96, 3, 3>(8, 8, ALL))
+		return 1;
+	if(!exact<1, 2, 1, 80, 80, 5, 5, int>(4, 6, ALL_EXACT))
+		return 1;
+
+	// ----- Single channel convolution -----
+	{
+		Matrix<3, 3, int> image = pattern<3, 3, int>(1);
+		Matrix<2, 2, int> kernel;
+		kernel[0][0] = 1; kernel[0][1] = 2;
+		kernel[1][0] = 3; kernel[1][1] = 4;
+
+		// Convolution rotates the kernel, so its last value meets the top left input
+		Matrix<2, 2, int> result = matrix::convolve2d(image, kernel);
+		int expected = 4 * image[0][0] + 3 * image[0][1] + 2 * image[1][0] + 1 * image[1][1];
+		if(result[0][0] != expected)
+			return 1;
+
+		Matrix<2, 2, int> flipped;
+		flipped[0][0] = 4; flipped[0][1] = 3;
+		flipped[1][0] = 2; flipped[1][1] = 1;
+		if(result != matrix::correlate2d(image, flipped, ConvolutionMethod::Im2col))
+			return 1;
+
+		// A centred impulse with same padding returns the input
+		Matrix<3, 3, double> impulse(0.0);
+		impulse[1][1] = 1.0;
+		Matrix<12, 10, double> input = pattern<12, 10, double>(4);
+		if(matrix::convolve2d<1, 1>(input, impulse) != input)
+			return 1;
+	}
+
+	// ----- Invalid arguments -----
+	{
+		std::vector<Matrix<6, 6, int>> input;
+		std::vector<std::vector<Matrix<3, 3, int>>> filters;
+		build(2, 2, input, filters);
+
+		bool threw = false;
+		try {
+			matrix::correlate2d(input, filters, ConvolutionMethod::Winograd);
+		}
+		catch(std::invalid_argument&) {
+			threw = true;
+		}
+		if(!threw)
+			return 1;
+
+		filters[1].pop_back();
+		threw = false;
+		try {
+			matrix::correlate2d(input, filters);
+		}
+		catch(std::invalid_argument&) {
+			threw = true;
+		}
+		if(!threw)
+			return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,126 @@
+/**
+ *  @file		test_distributed.cpp
+ *  @brief	  Entry for test-cases that test distributed multiplication
+ *
+ * 	Test SUMMA on forked local workers against the in-process product,
+ * 	over grids that don't divide the operands evenly
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-19-2026
+ *  @version	0.1
+ */
+
+#include <iostream>
+#include <stdexcept>
+#include <chrono>
+#include <thread>
+#include <string>
+
+#include "matrix/distributed.h"
+
+using matrix::Matrix;
+namespace distributed = matrix::distributed;
+
+/// Entry point into the code
+int main() {
+
+	// ----- Grids -----
+	{
+		distributed::ProcessGrid grid = distributed::ProcessGrid::square(6);
+		if(grid.getRows() != 2 || grid.getColumns() != 3 || grid.rankOf(1, 2) != 5)
+			return 1;
+		if(distributed::ProcessGrid::square(7).getRows() != 1)
+			return 1;
+		if(distributed::partition(10, 3, 0).second != 3 || distributed::partition(10, 3, 2).first != 6)
+			return 1;
+	}
+
+	// ----- Products match the single process product exactly -----
+	{
+		Matrix<37, 23, int> A;
+		Matrix<23, 41, int> B;
+		for(int i = 0; i < 37; ++i)
+			for(int j = 0; j < 23; ++j)
+				A[i][j] = (i * 7 + j * 3) % 11 - 5;
+		for(int i = 0; i < 23; ++i)
+			for(int j = 0; j < 41; ++j)
+				B[i][j] = (i * 5 + j * 13) % 9 - 4;
+		Matrix<37, 41, int> expected = A * B;
+
+		// Each rank supplies and checks only its own blocks, rank 0 counts the entries
+		for(int processes : {1, 2, 3, 4, 6}) {
+			distributed::ProcessGrid grid = distributed::ProcessGrid::square(processes);
+			distributed::runLocal(processes, [&] (distributed::Transport& transport) {
+				long entries = 0;
+				distributed::multiplyBlocks<int>(transport, grid, 37, 23, 41,
+						[&A] (int row, int column) { return A[row][column]; },
+						[&B] (int row, int column) { return B[row][column]; },
+						[&] (int row, int column, int value) {
+					if(value != expected[row][column])
+						throw std::runtime_error("mismatch with " + std::to_string(processes) + " processes");
+					++entries;
+				});
+
+				if(transport.rank() != 0) {
+					transport.send(0, &entries, sizeof(entries));
+					return;
+				}
+				for(int rank = 1; rank < transport.size(); ++rank) {
+					long received = 0;
+					transport.receive(rank, &received, sizeof(received));
+					entries += received;
+				}
+				if(entries != 37 * 41)
+					throw std::runtime_error("product blocks don't cover the product");
+			});
+		}
+
+		// Scattered from and gathered to this process
+		if(distributed::multiply(A, B, 4) != expected)
+			return 1;
+
+		// More ranks than rows of the grid has blocks to give
+		Matrix<2, 3, int> small(1);
+		Matrix<3, 2, int> other(2);
+		if(distributed::multiply(small, other, 4) != Matrix<2, 2, int>(6))
+			return 1;
+	}
+
+	// ----- Forked ranks can use the ThreadPool directly -----
+	{
+		// Keep a worker busy when forking, the children never touch the pool it runs on
+		auto busy = matrix::ThreadPool::getInstance().submit([] () {
+			std::this_thread::sleep_for(std::chrono::milliseconds(20));
+		});
+		distributed::runLocal(3, [] (distributed::Transport& transport) {
+			matrix::ThreadPool& pool = matrix::ThreadPool::getInstance();
+			if(transport.rank() != 0 && pool.size() != 1)
+				throw std::runtime_error("expected one worker");
+			if(pool.submit([] () { return matrix::ThreadPool::isWorkerThread(); }).get() != true)
+				throw std::runtime_error("job ran off the pool");
+		});
+		busy.get();
+	}
+
+	// ----- A failing rank is reported -----
+	{
+		bool reported = false;
+		try {
+			distributed::runLocal(3, [] (distributed::Transport& transport) {
+				if(transport.rank() == 2)
+					throw std::runtime_error("expected failure");
+				// Wait on the failed rank, its exit closes the connection
+				char byte;
+				if(transport.rank() == 1)
+					transport.receive(2, &byte, 1);
+			});
+		}
+		catch(const std::runtime_error&) {
+			reported = true;
+		}
+		if(!reported)
+			return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,132 @@
+/**
+ *  @file		test_graph.cpp
+ *  @brief	  Entry for test-cases that test the computation graph
+ *
+ * 	Test that evaluation matches the eager operators, that only nodes
+ * 	depending on a changed input recompute, and the chain ordering
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-19-2026
+ *  @version	0.1
+ */
+
+#include <iostream>
+#include <vector>
+
+#include "matrix/graph.h"
+
+using matrix::Matrix;
+namespace graph = matrix::graph;
+
+/// Fill a matrix with a pattern depending on seed
+template <int M, int N>
+Matrix<M, N, int> pattern(int seed) {
+	Matrix<M, N, int> m;
+	for(int i = 0; i < M; ++i)
+		for(int j = 0; j < N; ++j)
+			m[i][j] = (i * seed + j * 3 + seed) % 7 - 3;
+	return m;
+}
+
+/// Entry point into the code
+int main() {
+
+	// ----- Lazy evaluation and incremental recomputation -----
+	{
+		graph::Input<4, 3, int> A(pattern<4, 3>(1));
+		graph::Input<3, 5, int> B(pattern<3, 5>(2));
+		graph::Input<5, 2, int> C(pattern<5, 2>(3));
+		graph::Input<4, 2, int> D(pattern<4, 2>(4));
+
+		auto AB = A * B;
+		auto result = AB * C + D;
+
+		// Nothing computes until evaluated
+		if(AB.getNode()->getComputations() != 0)
+			return 1;
+
+		Matrix<4, 2, int> expected = A.get() * B.get() * C.get();
+		expected += D.get();
+		if(result.evaluate() != expected)
+			return 1;
+
+		// Evaluating again is served from the cache
+		result.evaluate();
+		if(AB.getNode()->getComputations() != 1 || result.getNode()->getComputations() != 1)
+			return 1;
+
+		// Changing C leaves A * B alone
+		C.set(pattern<5, 2>(5));
+		expected = A.get() * B.get() * C.get();
+		expected += D.get();
+		if(result.evaluate() != expected)
+			return 1;
+		if(AB.getNode()->getComputations() != 1 || result.getNode()->getComputations() != 2)
+			return 1;
+
+		// Changing A in place recomputes everything downstream of it
+		A.modify([] (Matrix<4, 3, int>& m) { m[0][0] += 10; });
+		expected = A.get() * B.get() * C.get();
+		expected += D.get();
+		if(result.evaluate() != expected || AB.getNode()->getComputations() != 2)
+			return 1;
+
+		// Other operations
+		auto other = graph::transpose(A - A * 2);
+		Matrix<4, 3, int> negated(0);
+		negated -= A.get();
+		if(other.evaluate() != negated.transpose())
+			return 1;
+	}
+
+	// ----- Shared subexpressions are visited once per evaluation -----
+	{
+		constexpr int DEPTH = 24;
+		graph::Input<2, 2, int> x(Matrix<2, 2, int>(1));
+		std::vector<graph::Expr<2, 2, int>> levels { x };
+		for(int level = 0; level < DEPTH; ++level)
+			levels.push_back(levels.back() + levels.back());
+
+		if(levels.back().evaluate() != Matrix<2, 2, int>(1 << DEPTH))
+			return 1;
+		levels.back().evaluate();
+		for(int level = 1; level <= DEPTH; ++level) {
+			const auto& node = levels[level].getNode();
+			if(node->getVisits() != 2 || node->getComputations() != 1)
+				return 1;
+		}
+
+		x.set(Matrix<2, 2, int>(2));
+		if(levels.back().evaluate() != Matrix<2, 2, int>(2 << DEPTH))
+			return 1;
+		if(levels.back().getNode()->getVisits() != 3 || levels[1].getNode()->getComputations() != 2)
+			return 1;
+	}
+
+	// ----- Chain ordering -----
+	{
+		// 10x100 * 100x5 * 5x50: (AB)C needs 7500 multiplications, A(BC) 75000
+		constexpr auto order = graph::chainOrder<3>({10, 100, 5, 50});
+		static_assert(order.cost[0][2] == 7500 && order.split[0][2] == 1, "wrong chain order");
+
+		// 50x5 * 5x100 * 100x10: A(BC) is cheaper
+		constexpr auto reverse = graph::chainOrder<3>({50, 5, 100, 10});
+		static_assert(reverse.split[0][2] == 0, "wrong chain order");
+
+		graph::Input<6, 30, int> A(pattern<6, 30>(1));
+		graph::Input<30, 2, int> B(pattern<30, 2>(2));
+		graph::Input<2, 40, int> C(pattern<2, 40>(3));
+		graph::Input<40, 3, int> E(pattern<40, 3>(4));
+		auto product = graph::chain(A, B, C, E);
+
+		Matrix<6, 3, int> expected = A.get() * B.get() * C.get() * E.get();
+		if(product.evaluate() != expected)
+			return 1;
+
+		E.set(pattern<40, 3>(6));
+		if(product.evaluate() != A.get() * B.get() * C.get() * E.get())
+			return 1;
+	}
+
+	return 0;
+}
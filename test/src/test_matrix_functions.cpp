@@ -0,0 +1,114 @@
+/**
+ *  @file		test_matrix_functions.cpp
+ *  @brief	  Entry for test-cases that test matrix powers and the exponential
+ *
+ * 	Test pow against repeated multiplication, and expm against closed forms
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-19-2026
+ *  @version	0.1
+ */
+
+#include <iostream>
+#include <cmath>
+
+#include "matrix/matrix_functions.h"
+
+using matrix::Matrix;
+
+/// Largest difference between two matrices
+template <int N>
+double distance(const Matrix<N, N, double>& lhs, const Matrix<N, N, double>& rhs) {
+	double largest = 0.0;
+	for(int i = 0; i < N; ++i)
+		for(int j = 0; j < N; ++j)
+			largest = std::max(largest, std::abs(lhs[i][j] - rhs[i][j]));
+	return largest;
+}
+
+/// Entry point into the code
+int main() {
+
+	// ----- pow matches repeated multiplication -----
+	{
+		Matrix<3, 3, int> A;
+		for(int i = 0; i < 3; ++i)
+			for(int j = 0; j < 3; ++j)
+				A[i][j] = (i + 2 * j) % 3 - 1;
+
+		Matrix<3, 3, int> expected = matrix::identity<3, int>();
+		for(unsigned long long k = 0; k <= 12; ++k) {
+			if(matrix::pow(A, k) != expected)
+				return 1;
+			expected = expected * A;
+		}
+
+		// Fibonacci numbers, F(31) = 1346269
+		Matrix<2, 2, int> fibonacci(1);
+		fibonacci[1][1] = 0;
+		if(matrix::pow(fibonacci, 30)[0][0] != 1346269)
+			return 1;
+	}
+
+	// ----- A Markov chain reaches its stationary distribution -----
+	{
+		Matrix<2, 2, double> P;
+		P[0][0] = 0.9; P[0][1] = 0.1;
+		P[1][0] = 0.5; P[1][1] = 0.5;
+		Matrix<2, 2, double> limit = matrix::pow(P, 1000000ULL);
+		// Stationary distribution is (5/6, 1/6) in every row, rounding drifts about k ulp
+		if(std::abs(limit[0][0] - 5.0 / 6.0) > 1e-9 || std::abs(limit[1][1] - 1.0 / 6.0) > 1e-9)
+			return 1;
+	}
+
+	// ----- expm against closed forms -----
+	{
+		if(matrix::expm(Matrix<3, 3, double>(0.0)) != matrix::identity<3, double>())
+			return 1;
+
+		// Nilpotent, e^A = I + A
+		Matrix<2, 2, double> nilpotent(0.0);
+		nilpotent[0][1] = 1.0;
+		Matrix<2, 2, double> expected = matrix::identity<2, double>();
+		expected[0][1] = 1.0;
+		if(distance(matrix::expm(nilpotent), expected) > 1e-15)
+			return 1;
+
+		// Rotations, small angles use a low degree approximant and large ones scale and square
+		for(double angle : {0.001, 0.2, 0.9, 2.0, 5.0, 40.0}) {
+			Matrix<2, 2, double> generator(0.0);
+			generator[0][1] = -angle;
+			generator[1][0] = angle;
+			Matrix<2, 2, double> rotation;
+			rotation[0][0] = std::cos(angle); rotation[0][1] = -std::sin(angle);
+			rotation[1][0] = std::sin(angle); rotation[1][1] = std::cos(angle);
+			if(distance(matrix::expm(generator), rotation) > 1e-13 * std::max(1.0, angle)) {
+				std::cerr << "rotation by " << angle << " is off" << std::endl;
+				return 1;
+			}
+		}
+
+		// Diagonal, e^D has e^d on the diagonal
+		Matrix<4, 4, double> diagonal(0.0);
+		for(int i = 0; i < 4; ++i)
+			diagonal[i][i] = i - 1.5;
+		Matrix<4, 4, double> exponential = matrix::expm(diagonal);
+		for(int i = 0; i < 4; ++i) {
+			if(std::abs(exponential[i][i] - std::exp(i - 1.5)) > 1e-14 * std::exp(i - 1.5))
+				return 1;
+		}
+
+		// e^A e^-A = I for a dense matrix
+		Matrix<6, 6, double> A, negated;
+		for(int i = 0; i < 6; ++i) {
+			for(int j = 0; j < 6; ++j) {
+				A[i][j] = std::sin(i * 1.3 + j * 0.7);
+				negated[i][j] = -A[i][j];
+			}
+		}
+		if(distance(matrix::expm(A) * matrix::expm(negated), matrix::identity<6, double>()) > 1e-12)
+			return 1;
+	}
+
+	return 0;
+}
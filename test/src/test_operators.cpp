@@ -75,6 +75,20 @@ int main() {
 		Matrix<2, 2> C = A * B;
 
 		std::cout << static_cast<std::string>(C) << std::endl;
+
+		// Non-square operands
+		Matrix<2, 3, int> D(1);
+		D[1][2] = 4;
+		Matrix<3, 4, int> E(2);
+		Matrix<2, 4, int> F = D * E;
+		if(F[0][3] != 6 || F[1][0] != 12)
+			return 1;
+
+		// Large enough to be blocked and split across the ThreadPool
+		Matrix<150, 130, double> G(1.0);
+		Matrix<130, 170, double> H(2.0);
+		if(G * H != Matrix<150, 170, double>(260.0))
+			return 1;
 	}
 
 	// ----- Array subscript -----
@@ -92,5 +106,14 @@ int main() {
 		std::cout << col1[0] << std::endl;
 	}
 
+	// ----- transpose() -----
+	{
+		Matrix<2, 3, int> A(1);
+		A[0][2] = 7;
+		Matrix<3, 2, int> B = A.transpose();
+		if(B[2][0] != 7 || B[2][1] != 1 || B.transpose() != A)
+			return 1;
+	}
+
 	return 0;
 }
\ No newline at end of file
@@ -0,0 +1,146 @@
+/**
+ *  @file		test_reduction.cpp
+ *  @brief	  Entry for test-cases that test reductions, broadcasting and maps
+ *
+ * 	Test each axis against a plain loop, and that parallel results are reproducible
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-19-2026
+ *  @version	0.1
+ */
+
+#include <iostream>
+#include <cmath>
+#include <vector>
+#include <limits>
+
+#include "matrix/reduction.h"
+
+using matrix::Matrix;
+using matrix::Axis;
+using matrix::KernelConfig;
+
+/// Build a matrix from nested lists of rows
+template <int M, int N, typename T>
+Matrix<M, N, T> make(const std::vector<std::vector<T>>& rows) {
+	Matrix<M, N, T> m;
+	for(int row = 0; row < M; ++row)
+		for(int column = 0; column < N; ++column)
+			m[row][column] = rows[row][column];
+	return m;
+}
+
+/// Entry point into the code
+int main() {
+
+	// ----- Small integer matrix, every axis -----
+	{
+		auto m = make<2, 3, int>({{1, -2, 3}, {4, 5, -6}});
+
+		if(matrix::sum(m) != 5 || matrix::min(m) != -6 || matrix::max(m) != 5)
+			return 1;
+		if(matrix::sum<Axis::Rows>(m) != make<1, 3, int>({{5, 3, -3}}))
+			return 1;
+		if(matrix::sum<Axis::Columns>(m) != make<2, 1, int>({{2}, {3}}))
+			return 1;
+		if(matrix::max<Axis::Rows>(m) != make<1, 3, int>({{4, 5, 3}}))
+			return 1;
+		if(matrix::min<Axis::Columns>(m) != make<2, 1, int>({{-2}, {-6}}))
+			return 1;
+
+		// Count the negative values with a mapped reduction
+		int negatives = matrix::mapReduce(m, 0, [] (int value) { return value < 0 ? 1 : 0; },
+				[] (int left, int right) { return left + right; });
+		if(negatives != 2)
+			return 1;
+
+		Matrix<2, 3, int> shifted = matrix::broadcastRow(m, make<1, 3, int>({{1, 2, 3}}),
+				[] (int value, int shift) { return value + shift; });
+		if(shifted != make<2, 3, int>({{2, 0, 6}, {5, 7, -3}}))
+			return 1;
+
+		Matrix<2, 3, int> scaled = matrix::broadcastColumn(m, make<2, 1, int>({{2}, {-1}}),
+				[] (int value, int scale) { return value * scale; });
+		if(scaled != make<2, 3, int>({{2, -4, 6}, {-4, -5, 6}}))
+			return 1;
+
+		// A 1 x 1 matrix is both a row and a column, the name picks which
+		auto single = make<1, 1, int>({{4}});
+		if(matrix::broadcastRow(single, single, [] (int value, int shift) { return value + shift; })[0][0] != 8
+				|| matrix::broadcastColumn(single, single, [] (int value, int scale) { return value * scale; })[0][0] != 16)
+			return 1;
+
+		// Integral values average and measure as double
+		if(matrix::mean(m) != 5.0 / 6.0 || matrix::mean<Axis::Columns>(m) != make<2, 1, double>({{2.0 / 3.0}, {1.0}}))
+			return 1;
+		if(matrix::norm(make<1, 2, int>({{3, 4}})) != 5.0)
+			return 1;
+
+		Matrix<2, 3, double> halves = matrix::map(m, [] (int value) { return value / 2.0; });
+		if(halves[1][2] != -3.0 || halves[0][0] != 0.5)
+			return 1;
+	}
+
+	// ----- Floating point, mean and norm -----
+	{
+		auto m = make<2, 2, double>({{3.0, 4.0}, {0.0, 12.0}});
+
+		if(matrix::norm(m) != 13.0 || matrix::mean(m) != 4.75)
+			return 1;
+		if(matrix::norm<Axis::Columns>(m) != make<2, 1, double>({{5.0}, {12.0}}))
+			return 1;
+		if(matrix::mean<Axis::Rows>(m) != make<1, 2, double>({{1.5, 8.0}}))
+			return 1;
+
+		// Infinite values are the extremes, not max() or lowest()
+		const double infinity = std::numeric_limits<double>::infinity();
+		Matrix<2, 2, double> high(infinity), low(-infinity);
+		if(matrix::min(high) != infinity || matrix::max(low) != -infinity)
+			return 1;
+		if(matrix::min<Axis::Rows>(high) != Matrix<1, 2, double>(infinity)
+				|| matrix::max<Axis::Columns>(low) != Matrix<2, 1, double>(-infinity))
+			return 1;
+	}
+
+	// ----- Large matrix, against a plain loop and across thread settings -----
+	{
+		constexpr int SIZE = 300;
+		Matrix<SIZE, SIZE, double> m;
+		for(int row = 0; row < SIZE; ++row)
+			for(int column = 0; column < SIZE; ++column)
+				m[row][column] = std::sin(row * 0.37 + column * 0.11);
+
+		double expected = 0.0;
+		Matrix<1, SIZE, double> expectedRows(0.0);
+		for(int row = 0; row < SIZE; ++row) {
+			for(int column = 0; column < SIZE; ++column) {
+				expected += m[row][column];
+				expectedRows[0][column] += m[row][column];
+			}
+		}
+
+		KernelConfig& config = KernelConfig::getInstance();
+		config.setParallelThreshold(1);
+		double parallel = matrix::sum(m);
+		Matrix<1, SIZE, double> parallelRows = matrix::sum<Axis::Rows>(m);
+		Matrix<SIZE, 1, double> parallelColumns = matrix::sum<Axis::Columns>(m);
+
+		config.setParallelThreshold(1L << 40);
+		double serial = matrix::sum(m);
+		config.reset();
+
+		// The block split is fixed, so both runs add in the same order
+		if(parallel != serial || matrix::sum<Axis::Rows>(m) != parallelRows)
+			return 1;
+		if(std::abs(parallel - expected) > 1e-9)
+			return 1;
+		for(int i = 0; i < SIZE; ++i) {
+			if(std::abs(parallelRows[0][i] - expectedRows[0][i]) > 1e-9)
+				return 1;
+		}
+		if(std::abs(matrix::sum(parallelColumns) - expected) > 1e-9)
+			return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,99 @@
+/**
+ *  @file		test_shared_matrix.cpp
+ *  @brief	  Entry for test-cases that test the copy-on-write matrix handle
+ *
+ * 	Test that copies share, that mutation detaches, and fan-out to threads
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-19-2026
+ *  @version	0.1
+ */
+
+#include <iostream>
+#include <thread>
+#include <atomic>
+#include <utility>
+#include <stdexcept>
+
+#include "matrix/shared_matrix.h"
+
+using matrix::Matrix;
+using matrix::SharedMatrix;
+
+/// Sum a matrix through its read-only interface
+double sum(const Matrix<100, 100, double>& m) {
+	double total = 0.0;
+	for(const auto& row : m.getMatrix())
+		for(double value : row)
+			total += value;
+	return total;
+}
+
+/// Entry point into the code
+int main() {
+
+	// ----- Copies share until one is modified -----
+	{
+		SharedMatrix<3, 3, int> a(Matrix<3, 3, int>(2));
+		SharedMatrix<3, 3, int> b = a;
+		if(!a.isShared() || &a.get() != &b.get())
+			return 1;
+
+		// Reads don't detach
+		const SharedMatrix<3, 3, int>& reader = b;
+		if(reader[1][1] != 2 || !a.isShared())
+			return 1;
+
+		// Writes do, and leave the other handle untouched
+		b[1][1] = 5;
+		if(a.isShared() || a.get() != Matrix<3, 3, int>(2) || b[1][1] != 5)
+			return 1;
+
+		b += Matrix<3, 3, int>(1);
+		b *= 2;
+		if(b.get()[0][0] != 6 || a.get()[0][0] != 2)
+			return 1;
+
+		// A sole owner modifies in place
+		const Matrix<3, 3, int>* before = &a.get();
+		a -= Matrix<3, 3, int>(2);
+		if(&a.get() != before || a != SharedMatrix<3, 3, int>(0))
+			return 1;
+
+		// A moved-from handle refuses writes instead of dereferencing nothing
+		SharedMatrix<3, 3, int> taken(std::move(a));
+		try {
+			a[0][0] = 1;
+			return 1;
+		}
+		catch(const std::logic_error&) { }
+		if(taken != SharedMatrix<3, 3, int>(0))
+			return 1;
+	}
+
+	// ----- Fan out to worker threads -----
+	{
+		SharedMatrix<100, 100, double> source(1.5);
+		std::atomic<int> correct(0);
+		std::vector<std::thread> workers;
+		for(int i = 0; i < 8; ++i) {
+			workers.emplace_back([source, i, &correct] () mutable {
+				if(sum(source) == 15000.0)
+					++correct;
+				// Half the workers modify their copy, which must not leak to the others
+				if(i % 2 == 0) {
+					source *= 2.0;
+					if(sum(source) == 30000.0)
+						++correct;
+				}
+			});
+		}
+		for(auto& worker : workers)
+			worker.join();
+
+		if(correct != 12 || source.isShared() || sum(source) != 15000.0)
+			return 1;
+	}
+
+	return 0;
+}
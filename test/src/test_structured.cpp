@@ -0,0 +1,120 @@
+/**
+ *  @file		test_structured.cpp
+ *  @brief	  Entry for test-cases that test the structured matrix types
+ *
+ * 	Each structured product is checked against the dense product
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-19-2026
+ *  @version	0.1
+ */
+
+#include <iostream>
+
+#include "matrix/diagonal_matrix.h"
+#include "matrix/triangular_matrix.h"
+#include "matrix/symmetric_matrix.h"
+#include "matrix/banded_matrix.h"
+
+using matrix::Matrix;
+
+/// Build a matrix with distinct entries
+template <int M, int N>
+Matrix<M, N, double> sequence() {
+	Matrix<M, N, double> result;
+	for(int row = 0; row < M; ++row)
+		for(int col = 0; col < N; ++col)
+			result[row][col] = row * N + col - 3;
+	return result;
+}
+
+/// Entry point into the code
+int main() {
+	Matrix<4, 3, double> B = sequence<4, 3>();
+
+	// ----- Diagonal -----
+	{
+		matrix::DiagonalMatrix<4, double> D({ 1.0, 2.0, 4.0, 0.5 });
+		if(D * B != D.toDense() * B)
+			return 1;
+		if(sequence<3, 4>() * D != sequence<3, 4>() * D.toDense())
+			return 1;
+		if(D * D.solve(B) != B)
+			return 1;
+	}
+
+	// ----- Triangular -----
+	{
+		Matrix<4, 4, double> dense = sequence<4, 4>();
+		for(int i = 0; i < 4; ++i)
+			dense[i][i] = 1 << i;
+		matrix::TriangularMatrix<4, double, matrix::Triangle::Lower> L(dense);
+		matrix::TriangularMatrix<4, double, matrix::Triangle::Upper> U(dense);
+
+		if(L * B != L.toDense() * B || U * B != U.toDense() * B)
+			return 1;
+		if(sequence<3, 4>() * L != sequence<3, 4>() * L.toDense())
+			return 1;
+		if(sequence<3, 4>() * U != sequence<3, 4>() * U.toDense())
+			return 1;
+		if(L.solve(L * B) != B || U.solve(U * B) != B)
+			return 1;
+		if(L.transpose().toDense() != L.toDense().transpose())
+			return 1;
+
+		try {
+			L.set(0, 3, 1.0);
+			return 1;
+		}
+		catch(const std::out_of_range&) { }
+	}
+
+	// ----- Symmetric -----
+	{
+		matrix::SymmetricMatrix<4, double> S(sequence<4, 4>());
+		if(S.toDense() != S.toDense().transpose() || S * B != S.toDense() * B)
+			return 1;
+		if(sequence<3, 4>() * S != sequence<3, 4>() * S.toDense())
+			return 1;
+
+		// S = 2 * A * A^T + 3 * S
+		Matrix<4, 4, double> expected = S.toDense() * 3.0;
+		expected += (B * B.transpose()) * 2.0;
+		S.rankUpdate(B, 2.0, 3.0);
+		if(S.toDense() != expected)
+			return 1;
+
+		// Split across the workers by rows of the product
+		matrix::KernelConfig& config = matrix::KernelConfig::getInstance();
+		config.setParallelThreshold(1);
+		matrix::SymmetricMatrix<37, double> large(sequence<37, 37>());
+		bool split = large * sequence<37, 5>() == large.toDense() * sequence<37, 5>() &&
+				sequence<5, 37>() * large == sequence<5, 37>() * large.toDense();
+		config.reset();
+		if(!split)
+			return 1;
+	}
+
+	// ----- Banded -----
+	{
+		matrix::BandedMatrix<4, 1, 2, double> band(sequence<4, 4>());
+		if(band.get(3, 0) != 0.0 || band.get(0, 2) != -1.0)
+			return 1;
+		if(band * B != band.toDense() * B)
+			return 1;
+		if(sequence<3, 4>() * band != sequence<3, 4>() * band.toDense())
+			return 1;
+
+		// Row vector times the band
+		Matrix<1, 4, double> y(1.0);
+		if(y * band != y * band.toDense())
+			return 1;
+
+		// Matrix-vector product
+		Matrix<4, 1, double> x(1.0);
+		if(band * x != band.toDense() * x)
+			return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,92 @@
+/**
+ *  @file		test_text_io.cpp
+ *  @brief	  Entry for test-cases that test formatting and parsing matrices as text
+ *
+ * 	Round trips each layout, including the parallel path for large matrices
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-19-2026
+ *  @version	0.1
+ */
+
+#include <iostream>
+#include <sstream>
+#include <fstream>
+#include <cstdio>
+#include <memory>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "matrix/text_io.h"
+
+using matrix::Matrix;
+using matrix::text::Layout;
+
+/// Entry point into the code
+int main(int argc, char** argv) {
+
+	// ----- String form keeps the pipe layout, with shortest round-trip values -----
+	{
+		Matrix<2, 2, double> A(0.1);
+		A[1][1] = -2.5e-300;
+		if(static_cast<std::string>(A) != "0.1\t|\t0.1\t|\t\n0.1\t|\t-2.5e-300\t|\t\n")
+			return 1;
+		if(matrix::text::parse<2, 2, double>(static_cast<std::string>(A)) != A)
+			return 1;
+	}
+
+	// ----- CSV and TSV round trips -----
+	{
+		Matrix<3, 4, int> A;
+		for(int row = 0; row < 3; ++row)
+			for(int col = 0; col < 4; ++col)
+				A[row][col] = (row - 1) * 1000 + col;
+
+		if(matrix::text::format(A, Layout::CSV).substr(0, 20) != "-1000,-999,-998,-997")
+			return 1;
+		for(Layout layout : { Layout::CSV, Layout::TSV, Layout::Pipe }) {
+			std::stringstream stream;
+			matrix::text::write(A, stream, layout);
+			if(matrix::text::read<3, 4, int>(stream, layout) != A)
+				return 1;
+		}
+	}
+
+	// ----- Malformed text -----
+	{
+		try {
+			matrix::text::parse<1, 2, int>("1,x\n", Layout::CSV);
+			return 1;
+		}
+		catch(const std::invalid_argument&) { }
+
+		try {
+			matrix::text::parse<2, 2, int>("1,2\n", Layout::CSV);
+			return 1;
+		}
+		catch(const std::out_of_range&) { }
+	}
+
+	// ----- Large matrix through a file descriptor, formatted and parsed in parallel -----
+	{
+		matrix::KernelConfig::getInstance().setParallelThreshold(1);
+		auto A = std::make_unique<Matrix<300, 20, double>>();
+		for(int row = 0; row < 300; ++row)
+			for(int col = 0; col < 20; ++col)
+				(*A)[row][col] = row / 7.0 - col * 1e10;
+
+		std::string path = std::string("text_io_") + (argc > 1 ? argv[1] : "0") + ".tsv";
+		int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+		matrix::text::write(*A, fd, Layout::TSV);
+		::close(fd);
+
+		std::ifstream in(path);
+		bool same = matrix::text::read<300, 20, double>(in, Layout::TSV) == *A;
+		std::remove(path.c_str());
+		if(!same)
+			return 1;
+	}
+
+	return 0;
+}
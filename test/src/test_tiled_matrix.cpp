@@ -0,0 +1,120 @@
+/**
+ *  @file		test_tiled_matrix.cpp
+ *  @brief	  Entry for test-cases that test the disk-backed tiled matrix
+ *
+ * 	Uses small tiles and a small cache so every path through the cache is taken
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-19-2026
+ *  @version	0.1
+ */
+
+#include <iostream>
+#include <cstdio>
+#include <string>
+#include <stdexcept>
+
+#include <unistd.h>
+
+#include "matrix/tiled_matrix.h"
+
+using matrix::Matrix;
+using matrix::TiledMatrix;
+
+/// Entry point into the code
+int main(int argc, char** argv) {
+	// Keep the files of concurrent test iterations apart
+	std::string suffix = std::string(argc > 1 ? argv[1] : "0") + ".bin";
+
+	{
+		TiledMatrix<10, 7, double, 4> a("tiled_a_" + suffix, 3);
+		TiledMatrix<7, 5, double, 4> b("tiled_b_" + suffix, 3);
+		TiledMatrix<10, 5, double, 4> c("tiled_c_" + suffix, 3);
+
+		// Fill the operands, forcing tiles out to disk along the way
+		for(int row = 0; row < 10; ++row)
+			for(int col = 0; col < 7; ++col)
+				a.set(row, col, row + 2.0 * col);
+		for(int row = 0; row < 7; ++row)
+			for(int col = 0; col < 5; ++col)
+				b.set(row, col, row - col + 0.5);
+
+		// ----- Multiplication -----
+		matrix::multiply(a, b, c);
+		for(int row = 0; row < 10; ++row) {
+			for(int col = 0; col < 5; ++col) {
+				double expected = 0.0;
+				for(int k = 0; k < 7; ++k)
+					expected += (row + 2.0 * k) * (k - col + 0.5);
+				if(c.get(row, col) != expected)
+					return 1;
+			}
+		}
+
+		// ----- Transpose -----
+		TiledMatrix<7, 10, double, 4> t("tiled_t_" + suffix, 3);
+		matrix::transpose(a, t);
+		for(int row = 0; row < 10; ++row)
+			for(int col = 0; col < 7; ++col)
+				if(t.get(col, row) != a.get(row, col))
+					return 1;
+
+		// ----- Elementwise -----
+		TiledMatrix<10, 7, double, 4> sum("tiled_sum_" + suffix, 3);
+		matrix::add(a, a, sum);
+		matrix::subtract(sum, a, sum);
+		matrix::scale(sum, 3.0, sum);
+		for(int row = 0; row < 10; ++row)
+			for(int col = 0; col < 7; ++col)
+				if(sum.get(row, col) != 3.0 * a.get(row, col))
+					return 1;
+
+		// ----- A tile handed out by readTile() isn't changed by later sets -----
+		auto before = a.readTile(0, 0);
+		a.set(0, 0, -1.0);
+		a.set(0, 1, -2.0);
+		if((*before)[0][0] != 0.0 || (*before)[0][1] != 2.0)
+			return 1;
+		if(a.get(0, 0) != -1.0 || (*a.readTile(0, 0))[0][1] != -2.0)
+			return 1;
+		a.flush();
+	}
+
+	// ----- Reopen from disk -----
+	{
+		TiledMatrix<10, 5, double, 4> c("tiled_c_" + suffix, 2);
+		double expected = 0.0;
+		for(int k = 0; k < 7; ++k)
+			expected += (9 + 2.0 * k) * (k - 4 + 0.5);
+		if(c.get(9, 4) != expected)
+			return 1;
+	}
+
+	// ----- A tile that fails to read is read again next time -----
+	{
+		std::string path = "tiled_short_" + suffix;
+		TiledMatrix<8, 8, double, 4> shortened(path, 2);
+		if(::truncate(path.c_str(), 0) != 0)
+			return 1;
+
+		bool failed = false;
+		try {
+			shortened.readTile(1, 1);
+		}
+		catch(const std::runtime_error&) {
+			failed = true;
+		}
+		if(!failed)
+			return 1;
+
+		if(::truncate(path.c_str(), 4 * 4 * 4 * sizeof(double)) != 0)
+			return 1;
+		if((*shortened.readTile(1, 1))[3][3] != 0.0)
+			return 1;
+	}
+
+	for(const char* name : { "tiled_a_", "tiled_b_", "tiled_c_", "tiled_t_", "tiled_sum_", "tiled_short_" })
+		std::remove((name + suffix).c_str());
+
+	return 0;
+}
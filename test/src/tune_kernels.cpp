@@ -0,0 +1,169 @@
+/**
+ *  @file		tune_kernels.cpp
+ *  @brief	  Entry for the tool that tunes the kernel parameters for this machine
+ *
+ * 	Sweeps the GEMM and transpose block sizes and the threading cutoffs of
+ * 	products and of elementwise kernels, then writes the fastest values to the file KernelConfig loads at startup.
+ * 	Usage: matrix_tune [output path]
+ *
+ *  @author		Gabriel Shelton	sheltongabe
+ *  @date		  10-19-2026
+ *  @version	0.1
+ */
+
+#include <iostream>
+#include <chrono>
+#include <limits>
+#include <memory>
+
+#include "matrix/matrix.h"
+
+using matrix::Matrix;
+using matrix::KernelConfig;
+
+/// Number of runs of each candidate, the fastest is kept
+static const int RUNS = 3;
+
+/// Time the fastest of RUNS calls to operation, in seconds
+template <typename Operation>
+double fastest(Operation operation) {
+	double best = std::numeric_limits<double>::max();
+	for(int run = 0; run < RUNS; ++run) {
+		auto start = std::chrono::steady_clock::now();
+		operation();
+		std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+		best = std::min(best, elapsed.count());
+	}
+	return best;
+}
+
+/// Time elementwise addition of Size x Size matrices, with the current threshold
+template <int Size>
+double timeAddition() {
+	auto lhs = std::make_unique<Matrix<Size, Size, double>>(1.0);
+	Matrix<Size, Size, double> rhs(2.0);
+
+	// Repeat small sizes so the timer has something to measure
+	int repeats = std::max(1, (1 << 20) / (Size * Size));
+	return fastest([&] () {
+		for(int i = 0; i < repeats; ++i)
+			(*lhs) += rhs;
+	}) / repeats;
+}
+
+/// Time the product of Size x Size matrices, with the current threshold
+template <int Size>
+double timeProduct() {
+	auto lhs = std::make_unique<Matrix<Size, Size, double>>(1.5);
+	auto rhs = std::make_unique<Matrix<Size, Size, double>>(0.5);
+
+	int repeats = std::max(1, (1 << 24) / (Size * Size * Size));
+	return fastest([&] () {
+		for(int i = 0; i < repeats; ++i)
+			(*lhs) * (*rhs);
+	}) / repeats;
+}
+
+/// Find the smallest Size x Size addition that runs faster threaded, or 0
+template <int Size, int... Larger>
+long findElementwiseCrossover(KernelConfig& config) {
+	config.setElementwiseThreshold(std::numeric_limits<long>::max());
+	double serial = timeAddition<Size>();
+	config.setElementwiseThreshold(1);
+	double parallel = timeAddition<Size>();
+	std::cout << "add " << Size << "x" << Size << ": serial " << serial
+			<< "s, parallel " << parallel << "s" << std::endl;
+
+	// Demand a clear win, so timer noise doesn't pick the cutoff
+	if(parallel < 0.9 * serial)
+		return static_cast<long>(Size) * Size;
+	if constexpr(sizeof...(Larger) > 0)
+		return findElementwiseCrossover<Larger...>(config);
+	else
+		return 0;
+}
+
+/// Find the smallest Size x Size product that runs faster threaded, in multiply-adds, or 0
+template <int Size, int... Larger>
+long findGemmCrossover(KernelConfig& config) {
+	config.setGemmThreshold(std::numeric_limits<long>::max());
+	double serial = timeProduct<Size>();
+	config.setGemmThreshold(1);
+	double parallel = timeProduct<Size>();
+	std::cout << "gemm " << Size << "x" << Size << ": serial " << serial
+			<< "s, parallel " << parallel << "s" << std::endl;
+
+	if(parallel < 0.9 * serial)
+		return static_cast<long>(Size) * Size * Size;
+	if constexpr(sizeof...(Larger) > 0)
+		return findGemmCrossover<Larger...>(config);
+	else
+		return 0;
+}
+
+/// Entry point into the code
+int main(int argc, char** argv) {
+	std::string path = (argc > 1) ? argv[1] : KernelConfig::getDefaultPath();
+	KernelConfig& config = KernelConfig::getInstance();
+	config.reset();
+
+	// ----- Threading cutoffs, measured first so the block sweeps stay single threaded -----
+	long elementwiseThreshold = 0, gemmThreshold = 0;
+	if(matrix::ThreadPool::getInstance().size() > 1) {
+		elementwiseThreshold = findElementwiseCrossover<32, 64, 128, 256, 512, 1024>(config);
+		gemmThreshold = findGemmCrossover<8, 16, 32, 64, 128, 256>(config);
+	}
+	config.setParallelThreshold(std::numeric_limits<long>::max());
+
+	// ----- GEMM block size -----
+	{
+		auto lhs = std::make_unique<Matrix<384, 384, double>>(1.5);
+		auto rhs = std::make_unique<Matrix<384, 384, double>>(0.5);
+		double best = std::numeric_limits<double>::max();
+		int bestBlock = KernelConfig::DEFAULT_GEMM_BLOCK_SIZE;
+
+		for(int block : { 16, 32, 48, 64, 96, 128, 192, 256, 384 }) {
+			config.setGemmBlockSize(block);
+			double seconds = fastest([&] () { (*lhs) * (*rhs); });
+			std::cout << "gemm block " << block << ": " << seconds << "s" << std::endl;
+			if(seconds < best) {
+				best = seconds;
+				bestBlock = block;
+			}
+		}
+		config.setGemmBlockSize(bestBlock);
+	}
+
+	// ----- Transpose block size -----
+	{
+		auto source = std::make_unique<Matrix<1024, 1024, double>>(1.0);
+		double best = std::numeric_limits<double>::max();
+		int bestBlock = KernelConfig::DEFAULT_TRANSPOSE_BLOCK_SIZE;
+
+		for(int block : { 4, 8, 16, 32, 64, 128, 256 }) {
+			config.setTransposeBlockSize(block);
+			double seconds = fastest([&] () { source->transpose(); });
+			std::cout << "transpose block " << block << ": " << seconds << "s" << std::endl;
+			if(seconds < best) {
+				best = seconds;
+				bestBlock = block;
+			}
+		}
+		config.setTransposeBlockSize(bestBlock);
+	}
+
+	// Threading never paid off for the sizes tried (or there is one worker), so only thread beyond them
+	config.setElementwiseThreshold(elementwiseThreshold > 0 ? elementwiseThreshold : 4L * 1024 * 1024);
+	config.setGemmThreshold(gemmThreshold > 0 ? gemmThreshold : 512L * 512 * 512);
+
+	if(!config.save(path)) {
+		std::cerr << "Unable to write " << path << std::endl;
+		return 1;
+	}
+
+	std::cout << "Wrote " << path << ": gemm_block_size=" << config.getGemmBlockSize()
+			<< " transpose_block_size=" << config.getTransposeBlockSize()
+			<< " gemm_threshold=" << config.getGemmThreshold()
+			<< " elementwise_threshold=" << config.getElementwiseThreshold() << std::endl;
+	return 0;
+}